@@ -8,6 +8,8 @@ module.exports = b.suite(
     async () => readTest('/vsimem/AROME_T2m_10.tiff', true)),
   b.add('RasterReadStream w/o blockOptimize',
     async () => readTest('/vsimem/AROME_T2m_10.tiff', false)),
+  b.add('RasterReadStream w/ blockOptimize w/ readAhead',
+    async () => readTest('/vsimem/AROME_T2m_10.tiff', true, 4)),
   b.add('RasterReadStream w/ blockOptimize w/async iterator',
     async () => readTestAsyncIterator('/vsimem/AROME_T2m_10.tiff', true)),
   b.add('RasterReadStream w/o blockOptimize w/async iterator',
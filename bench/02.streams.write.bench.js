@@ -10,7 +10,7 @@ module.exports = b.suite(
     async () => writeTest(801, 601, 267, 2, true)),
   // This one is unusually fast because it uses static allocation
   // The same buffer, containing a pattern, is used over and over again
-  // Reading can't do this - it must allocate a new buffer on every operation
+  // Reading can do this only when the consumer returns the buffers with the `pool` option
   b.add('RasterWriteStream w/ zero-copy',
     async () => writeTest(801, 601, 1803, 3, true)),
   b.add('RasterWriteStream in line mode w/ big chunks',
@@ -44,10 +44,10 @@ const runTest = async (test, args) => {
   return async () => test.apply(null, args)
 }
 
-async function readTest(file, blockOptimize) {
+async function readTest(file, blockOptimize, readAhead) {
   const ds = await gdal.openAsync(path.resolve(__dirname, '..', 'test', 'data', file))
   const band = await ds.bands.getAsync(1)
-  const rs = band.pixels.createReadStream({ blockOptimize })
+  const rs = band.pixels.createReadStream({ blockOptimize, readAhead })
   let length = 0
   rs.on('data', (chunk) => length += chunk.length)
 
@@ -14,6 +14,7 @@
 				"src/utils/number_list.cpp",
 				"src/utils/warp_options.cpp",
 				"src/utils/ptr_manager.cpp",
+				"src/utils/srs_cache.cpp",
 				"src/node_gdal.cpp",
 				"src/async.cpp",
 				"src/gdal_common.cpp",
@@ -42,6 +43,7 @@
 				"src/geometry/gdal_multicurve.cpp",
 				"src/geometry/gdal_multipolygon.cpp",
 				"src/gdal_layer.cpp",
+				"src/gdal_arrow_stream.cpp",
 				"src/gdal_coordinate_transformation.cpp",
 				"src/gdal_spatial_reference.cpp",
 				"src/gdal_warper.cpp",
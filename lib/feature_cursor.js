@@ -0,0 +1,150 @@
+module.exports = function (gdal) {
+
+  /**
+ * Returns a cursor over the features of the layer that reuses
+ * a single {@link Feature} object, see {@link FeatureCursor}
+ *
+ * @example
+ *
+ * for (const feature of layer.features.cursor()) {
+ *   sum += feature.fields.get('population');
+ * }
+ *
+ * @memberof LayerFeatures
+ * @instance
+ * @method cursor
+ * @returns {FeatureCursor}
+ */
+  gdal.LayerFeatures.prototype.cursor = function () {
+    return new FeatureCursor(this)
+  }
+
+  /**
+ * A cursor over the features of a layer that reuses a single {@link Feature}
+ * object, the underlying feature is replaced on every step
+ *
+ * This avoids creating a new `Feature` for every feature when scanning
+ * large layers, but the returned feature reflects only the current step,
+ * use `feature.clone()` to keep it. The values returned by `fields` and
+ * the geometries returned by `getGeometry()` are copies, they remain valid
+ * after the next step
+ *
+ * Iterating always starts from the first feature of the layer
+ *
+ * @example
+ *
+ * for await (const feature of layer.features.cursor()) {
+ *   console.log(feature.fid);
+ * }
+ *
+ * @class FeatureCursor
+ * @constructor
+ * @param {LayerFeatures} features
+ */
+  class FeatureCursor {
+    constructor(features) {
+      this.features = features
+      this.started = false
+      this.ended = false
+      this._feature = null
+    }
+
+    /**
+   * Restarts from the first feature on the next step
+   *
+   * @memberof FeatureCursor
+   * @instance
+   * @method reset
+   */
+    reset() {
+      this.started = false
+      this.ended = false
+    }
+
+    /**
+   * Advances to the next feature and returns the shared {@link Feature}
+   * object, or `null` if there are no more features
+   *
+   * @memberof FeatureCursor
+   * @instance
+   * @method next
+   * @returns {Feature|null}
+   */
+    next() {
+      if (this.ended) return null
+      const reset = !this.started
+      this.started = true
+      // The shared Feature is created from the first feature
+      if (!this._feature) {
+        this._feature = this.features.first()
+        if (this._feature) return this._feature
+      } else if (this.features.nextInto(this._feature, reset)) {
+        return this._feature
+      }
+      this.ended = true
+      return null
+    }
+
+    /**
+   * Advances to the next feature and returns the shared {@link Feature}
+   * object, or `null` if there are no more features
+   * @async
+   *
+   * @memberof FeatureCursor
+   * @instance
+   * @method nextAsync
+   * @returns {Promise<Feature|null>}
+   */
+    nextAsync() {
+      if (this.ended) return Promise.resolve(null)
+      const reset = !this.started
+      this.started = true
+      if (!this._feature) {
+        return this.features.firstAsync().then((feature) => {
+          this._feature = feature
+          if (!feature) this.ended = true
+          return feature
+        })
+      }
+      return this.features.nextIntoAsync(this._feature, reset).then((found) => {
+        if (found) return this._feature
+        this.ended = true
+        return null
+      })
+    }
+
+    /**
+   * Iterates through all features, always returning the same {@link Feature} object
+   *
+   * @memberof FeatureCursor
+   * @type {Feature}
+   * @method Symbol.iterator
+   */
+    [Symbol.iterator]() {
+      this.reset()
+      return {
+        next: () => {
+          const value = this.next()
+          return { done: !value, value }
+        }
+      }
+    }
+
+    /**
+   * Iterates through all features using an async iterator,
+   * always returning the same {@link Feature} object
+   *
+   * @memberof FeatureCursor
+   * @type {Feature}
+   * @method Symbol.asyncIterator
+   */
+    [Symbol.asyncIterator]() {
+      this.reset()
+      return {
+        next: () => this.nextAsync().then((value) => ({ done: !value, value }))
+      }
+    }
+  }
+
+  gdal.FeatureCursor = FeatureCursor
+}
@@ -142,6 +142,10 @@ gdal.Layer.prototype.getExtent = function () {
   const obj = getExtent.apply(this, arguments)
   return new gdal.Envelope(obj)
 }
+const getExtentAsync = gdal.Layer.prototype.getExtentAsync
+gdal.Layer.prototype.getExtentAsync = function (force, callback) {
+  return getExtentAsync.call(this, force, (e, obj) => callback(e, e ? undefined : new gdal.Envelope(obj)))
+}
 
 const readStream = require('./readable.js')
 const writeStream = require('./writable.js')
@@ -153,6 +157,10 @@ gdal.RasterWriteStream = writeStream.RasterWriteStream
 gdal.RasterMuxStream = muxStream.RasterMuxStream
 gdal.RasterTransform = muxStream.RasterTransform
 
+const geojsonStream = require('./geojson.js')
+gdal.Layer.prototype.createGeoJSONStream = geojsonStream.createGeoJSONStream
+gdal.LayerGeoJSONStream = geojsonStream.LayerGeoJSONStream
+
 gdal.calcAsync = require('./calc')(gdal)
 
 gdal.wrapVRT = require('./wrapVRT')
@@ -321,6 +329,7 @@ gdal.DatasetBands.prototype.getEnvelope = function () {
 }
 
 require('./iterators.js')(gdal)
+require('./feature_cursor.js')(gdal)
 
 /**
  * Creates or opens a dataset. Dataset should be explicitly closed with `dataset.close()` method if opened in `"w"` mode to flush any changes. Otherwise, datasets are closed when (and if) node decides to garbage collect them.
@@ -337,7 +346,7 @@ require('./iterators.js')(gdal)
  * @method open
  * @static
  * @param {string|Buffer} path Path to dataset or in-memory Buffer to open
- * @param {string} [mode="r"] The mode to use to open the file: `"r"`, `"r+"`, or `"w"`
+ * @param {string} [mode="r"] The mode to use to open the file: `"r"`, `"r+"`, or `"w"`, `"rp"` opens a read-only dataset with 4 handles that allow parallel async raster reads, see {@link openPool}
  * @param {string|string[]} [drivers] Driver name, or list of driver names to attempt to use.
  *
  * @param {number} [x_size] Used when creating a raster dataset with the `"w"` mode.
@@ -437,7 +446,7 @@ const callbackify = require('util').callbackify
  * @method openAsync
  * @static
  * @param {string|Buffer} path Path to dataset or in-memory Buffer to open
- * @param {string} [mode="r"] The mode to use to open the file: `"r"`, `"r+"`, or `"w"`
+ * @param {string} [mode="r"] The mode to use to open the file: `"r"`, `"r+"`, or `"w"`, `"rp"` opens a read-only dataset with 4 handles that allow parallel async raster reads, see {@link openPool}
  * @param {string|string[]} [drivers] Driver name, or list of driver names to attempt to use.
  *
  * @param {number} [x_size] Used when creating a raster dataset with the `"w"` mode.
@@ -715,6 +724,19 @@ const mangleMDArray = (args) => {
   return args
 }
 
+const mangleDatasetRead = (args) => {
+  const options = args[4]
+  if (options && options.data) options.data._gdal_type = getTypedArrayType(options.data)
+  return args
+}
+
+gdal.Dataset.prototype.read = (function () {
+  const read = gdal.Dataset.prototype.read
+  return function () {
+    return read.apply(this, mangleDatasetRead(arguments))
+  }
+})()
+
 gdal.RasterBandPixels.prototype.read = (function () {
   const read = gdal.RasterBandPixels.prototype.read
   return function () {
@@ -768,13 +790,25 @@ const promisifiables = {
   },
   Dataset: {
     flushAsync: 0,
+    startTransactionAsync: 1,
+    commitTransactionAsync: 0,
+    rollbackTransactionAsync: 0,
     buildOverviewsAsync: 4,
+    readAsync: 5,
     executeSQLAsync: 3,
     getMetadataAsync: 1,
     setMetadataAsync: 2
   },
   Layer: {
-    flushAsync: 0
+    flushAsync: 0,
+    getExtentAsync: 1,
+    setSpatialFilterAsync: 4,
+    setAttributeFilterAsync: 1,
+    getArrowStreamAsync: 1,
+    writeBatchAsync: 1
+  },
+  ArrowStream: {
+    nextAsync: 0
   },
   RasterBand: {
     flushAsync: 0,
@@ -785,8 +819,11 @@ const promisifiables = {
   },
   RasterBandPixels: {
     readAsync: 13,
+    readMultiAsync: 2,
+    sampleAsync: 2,
     writeAsync: 11,
     readBlockAsync: 3,
+    readBlockRefAsync: 2,
     writeBlockAsync: 3,
     clampBlockAsync: 2,
     getAsync: 2,
@@ -804,7 +841,13 @@ const promisifiables = {
     setAsync: 2,
     firstAsync: 0,
     nextAsync: 0,
+    nextBatchAsync: 1,
+    nextIntoAsync: 2,
+    toObjectsAsync: 1,
+    nextGeoJSONAsync: 2,
+    queryAsync: 1,
     addAsync: 1,
+    addManyAsync: 2,
     countAsync: 1,
     removeAsync: 1
   },
@@ -823,6 +866,7 @@ const promisifiables = {
     $fromWKBAsync: 2,
     $fromGeoJsonAsync: 1,
     $fromGeoJsonBufferAsync: 1,
+    $fromCoordinatesAsync: 4,
     toKMLAsync: 0,
     toGMLAsync: 0,
     toWKTAsync: 0,
@@ -841,6 +885,7 @@ const promisifiables = {
     bufferAsync: 2,
     getEnvelopeAsync: 0,
     getEnvelope3DAsync: 0,
+    getCoordinatesAsync: 1,
     closeRingsAsync: 0,
     emptyAsync: 0,
     swapXYAsync: 0,
@@ -861,10 +906,20 @@ const promisifiables = {
     transformAsync: 1,
     transformToAsync: 1
   },
+  CoordinateTransformation: {
+    $createAsync: 2,
+    transformArraysAsync: 3
+  },
   SpatialReference: {
     $fromURLAsync: 1,
     $fromCRSURLAsync: 1,
-    $fromUserInputAsync: 1
+    $fromUserInputAsync: 1,
+    $fromWKTAsync: 1,
+    $fromProj4Async: 1,
+    $fromEPSGAsync: 1,
+    $fromEPSGAAsync: 1,
+    $fromESRIAsync: 1,
+    validateAsync: 0
   },
   MDArray: {
     readAsync: 1
@@ -893,12 +948,16 @@ const promisifiables = {
     $warpAsync: 5,
     $buildVRTAsync: 4,
     $rasterizeAsync: 4,
+    $openPoolAsync: 2,
     $demAsync: 6,
     $_acquireLocksAsync: 3
   }
 }
 
 const argMangle = {
+  Dataset: {
+    readAsync: mangleDatasetRead
+  },
   RasterBandPixels: {
     readAsync: mangleRead,
     writeAsync: mangleWrite,
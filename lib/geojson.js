@@ -0,0 +1,117 @@
+const { Readable } = require('stream')
+
+const debug = process.env.NODE_DEBUG && process.env.NODE_DEBUG.match(/gdal_geojson|gdal([^_]|$)/) ?
+  console.debug.bind(console, 'LayerGeoJSONStream:') :
+  () => undefined
+
+const header = Buffer.from('{"type":"FeatureCollection","features":[\n')
+const separator = Buffer.from(',\n')
+const footer = Buffer.from('\n]}\n')
+
+/**
+ * @interface GeoJSONReadableOptions
+ * @extends stream.ReadableOptions
+ * @property {boolean} [ndjson]
+ * @property {number} [precision]
+ * @property {string[]} [fields]
+ * @property {number} [batchSize]
+ */
+
+/**
+ * create a Readable stream of the features of a layer serialized as GeoJSON
+ *
+ * @memberof Layer
+ * @instance
+ * @method createGeoJSONStream
+ * @param {GeoJSONReadableOptions} [options]
+ * @param {boolean} [options.ndjson=false] Produce newline-delimited GeoJSON instead of a `FeatureCollection`
+ * @param {number} [options.precision=undefined] Maximum number of decimals of the coordinates
+ * @param {string[]} [options.fields=undefined] Fields to include in the properties, all by default
+ * @param {number} [options.batchSize=1000] Number of features serialized in each chunk
+ * @returns {LayerGeoJSONStream}
+ */
+function createGeoJSONStream(options) {
+  const readable = new LayerGeoJSONStream({ ...options || {}, layer: this })
+  return readable
+}
+
+/**
+ * Class implementing {@link Layer} reading as a stream of GeoJSON text
+ *
+ * The features are serialized in a background thread, in chunks of
+ * `batchSize` features, without creating any JS object for them
+ *
+ * The layer is read from its first feature and it should not be read
+ * by other means while the stream is in use
+ *
+ * @example
+ *
+ *  layer.createGeoJSONStream({ ndjson: true, precision: 6 })
+ *    .pipe(fs.createWriteStream('layer.ndjson'))
+ *
+ * @class LayerGeoJSONStream
+ * @extends stream.Readable
+ * @constructor
+ * @param {GeoJSONReadableOptions} [options]
+ * @param {Layer} options.layer Layer to use
+ * @param {boolean} [options.ndjson=false] Produce newline-delimited GeoJSON instead of a `FeatureCollection`
+ * @param {number} [options.precision=undefined] Maximum number of decimals of the coordinates
+ * @param {string[]} [options.fields=undefined] Fields to include in the properties, all by default
+ * @param {number} [options.batchSize=1000] Number of features serialized in each chunk
+ */
+class LayerGeoJSONStream extends Readable {
+  constructor(options) {
+    super({ ...options, objectMode: false })
+    this.layer = options.layer
+    this.batchSize = 1000
+    this.started = false
+    this.reading = false
+
+    if (typeof options.batchSize !== 'undefined') {
+      if (!Number.isInteger(options.batchSize) || options.batchSize < 1) {
+        throw new TypeError('"batchSize" must be a positive integer')
+      }
+      this.batchSize = options.batchSize
+    }
+
+    if (!options.layer || !options.layer.features) {
+      throw new TypeError('"layer" must be a gdal.Layer')
+    }
+
+    this.ndjson = !!options.ndjson
+    this.options = { ndjson: this.ndjson, reset: true }
+    if (typeof options.precision !== 'undefined') this.options.precision = options.precision
+    if (typeof options.fields !== 'undefined') this.options.fields = options.fields
+  }
+
+  _read() {
+    if (this.reading) return
+    this.reading = true
+    this.layer.features.nextGeoJSONAsync(this.batchSize, this.options)
+      .then((data) => {
+        this.reading = false
+        if (this.destroyed) return
+        this.options.reset = false
+        if (!this.started && !this.ndjson) this.push(header)
+        if (data === null) {
+          debug('end of layer')
+          if (!this.ndjson) this.push(footer)
+          this.push(null)
+          return
+        }
+        if (this.started && !this.ndjson) this.push(separator)
+        this.started = true
+        debug('pushing', data.length, 'bytes')
+        this.push(data)
+      })
+      .catch((e) => {
+        this.reading = false
+        this.destroy(e)
+      })
+  }
+}
+
+module.exports = {
+  createGeoJSONStream,
+  LayerGeoJSONStream
+}
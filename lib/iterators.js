@@ -127,6 +127,9 @@ module.exports = function (gdal) {
   /**
  * Iterates through all features using an async iterator
  *
+ * The features are retrieved in batches of `LayerFeatures.asyncIteratorBatchSize`
+ * (64 by default) features with `nextBatchAsync()`
+ *
  * @example
  *
  * for await (const feature of layer.features) {
@@ -138,15 +141,85 @@ module.exports = function (gdal) {
  */
   if (Symbol.asyncIterator) {
     gdal.LayerFeatures.prototype[Symbol.asyncIterator] = function () {
-      let feature
+      const batchSize = gdal.LayerFeatures.asyncIteratorBatchSize
+      let batch = []
+      let started = false
+      let done = false
+
+      const fetch = () => {
+        if (started) return this.nextBatchAsync(batchSize)
+        started = true
+        return this.firstAsync().then((first) => first ?
+          (batchSize > 1 ? this.nextBatchAsync(batchSize - 1) : Promise.resolve([]))
+            .then((rest) => [ first ].concat(rest)) :
+          [])
+      }
 
       return {
         next: () => {
-          feature = feature ? this.nextAsync() : this.firstAsync()
-          return feature.then((value) => ({
-            done: !value,
-            value
-          }))
+          if (batch.length > 0) return Promise.resolve({ done: false, value: batch.shift() })
+          if (done) return Promise.resolve({ done: true, value: null })
+          return fetch().then((features) => {
+            if (features.length < batchSize) done = true
+            batch = features
+            if (batch.length === 0) return { done: true, value: null }
+            return { done: false, value: batch.shift() }
+          })
+        }
+      }
+    }
+  }
+
+  /**
+ * Number of features retrieved in each asynchronous operation
+ * by the `LayerFeatures` async iterator, 64 by default
+ *
+ * @kind member
+ * @name asyncIteratorBatchSize
+ * @static
+ * @memberof LayerFeatures
+ * @type {number}
+ */
+  gdal.LayerFeatures.asyncIteratorBatchSize = 64
+
+  if (gdal.ArrowStream) {
+    /**
+ * Iterates through all record batches using an iterator
+ *
+ * @example
+ *
+ * for (const batch of layer.getArrowStream()) {
+ * }
+ *
+ * @memberof ArrowStream
+ * @type {ArrowRecordBatch}
+ * @method Symbol.iterator
+ */
+    gdal.ArrowStream.prototype[Symbol.iterator] = function () {
+      return {
+        next: () => {
+          const value = this.next()
+          return { done: !value, value }
+        }
+      }
+    }
+
+    /**
+ * Iterates through all record batches using an async iterator
+ *
+ * @example
+ *
+ * for await (const batch of await layer.getArrowStreamAsync()) {
+ * }
+ *
+ * @memberof ArrowStream
+ * @type {ArrowRecordBatch}
+ * @method Symbol.asyncIterator
+ */
+    if (Symbol.asyncIterator) {
+      gdal.ArrowStream.prototype[Symbol.asyncIterator] = function () {
+        return {
+          next: () => this.nextAsync().then((value) => ({ done: !value, value }))
         }
       }
     }
@@ -46,6 +46,11 @@ const debug = process.env.NODE_DEBUG && process.env.NODE_DEBUG.match(/gdal_mux|g
  *
  *  mux.pipe(espyEstimation).pipe(ws);
  *
+ * When the `pool` option is set, the chunks can be returned with
+ * {@link RasterMuxStream.release} once they have been processed - the buffers
+ * allocated by the multiplexer are reused by the multiplexer while the buffers
+ * passed through from the inputs are returned to their {@link RasterReadStream}
+ * which must have its own `pool` option set.
  *
  * @class RasterMuxStream
  * @extends stream.Readable
@@ -53,6 +58,7 @@ const debug = process.env.NODE_DEBUG && process.env.NODE_DEBUG.match(/gdal_mux|g
  * @param {Record<string,RasterReadStream>} inputs Input streams
  * @param {RasterReadableOptions} [options]
  * @param {boolean} [options.blockOptimize=true] Read by file blocks when possible (when rasterSize.x == blockSize.x)
+ * @param {number} [options.pool=0] Maximum number of consolidated buffers returned with `RasterMuxStream.release()` to keep for reuse for each input
  */
 class RasterMuxStream extends Readable {
   constructor(inputs, options) {
@@ -65,6 +71,9 @@ class RasterMuxStream extends Readable {
     this.endHandlers = {}
     this.blockOptimize = (options || {}).blockOptimize
     this.rasterHighWaterMark = Infinity
+    this.poolSize = (options || {}).pool || 0
+    this.pools = {}
+    this.allocated = new WeakSet()
 
     for (const id of this.ids) {
       const inp = inputs[id]
@@ -74,6 +83,7 @@ class RasterMuxStream extends Readable {
       this.inputs[id] = inp
       this.buffers[id] = []
       this.buffersTotalData[id] = 0
+      this.pools[id] = []
       this.dataHandlers[id] = this.handleIncoming.bind(this, id)
 
       this.inputs[id].pause()
@@ -112,13 +122,13 @@ class RasterMuxStream extends Readable {
       } else {
         // block consolidation mode
         debug('block consolidation from', id, this.buffers[id].map((buf) => buf && buf.length || 'null').join(','))
-        send[id] = new this.buffers[id][0].constructor(maxReady)
+        send[id] = this.allocate(id, this.buffers[id][0].constructor, maxReady)
         let len = 0
         while (len + this.buffers[id][0].length < maxReady) {
           debug('chunking')
-          send[id].set(this.buffers[0], len)
+          send[id].set(this.buffers[id][0], len)
           len += this.buffers[id][0].length
-          this.buffers[id].shift()
+          this.releaseInput(id, this.buffers[id].shift())
           if (this.buffers[id][0] === null) {
             // one of the inputs ended before the others
             debug('destroy on premature end', id)
@@ -131,7 +141,7 @@ class RasterMuxStream extends Readable {
         if (maxReady - len < this.buffers[id][0].length) {
           this.buffers[id][0] = this.buffers[id][0].subarray(maxReady - len)
         } else {
-          this.buffers[id].shift()
+          this.releaseInput(id, this.buffers[id].shift())
         }
       }
       this.buffersTotalData[id] -= maxReady
@@ -146,6 +156,43 @@ class RasterMuxStream extends Readable {
     this.throttle(flowing)
   }
 
+  allocate(id, type, len) {
+    const pool = this.pools[id]
+    const idx = pool.findIndex((buf) => buf.length === len && buf instanceof type)
+    if (idx >= 0) return pool.splice(idx, 1)[0]
+    const buf = new type(len)
+    if (this.poolSize > 0) this.allocated.add(buf)
+    return buf
+  }
+
+  // The input buffers fully copied in block consolidation mode can be recycled right away
+  releaseInput(id, buf) {
+    if (typeof this.inputs[id].release === 'function') this.inputs[id].release(buf)
+  }
+
+  /**
+   * Return a chunk produced by this stream for reuse, requires the `pool` option
+   *
+   * None of the buffers of the chunk must be accessed after it has been released.
+   *
+   * @method release
+   * @memberof RasterMuxStream
+   * @instance
+   * @param {Record<string, TypedArray>} chunk
+   * @returns {void}
+   */
+  release(chunk) {
+    for (const id of this.ids) {
+      const buf = chunk[id]
+      if (!buf) continue
+      if (this.allocated.has(buf)) {
+        if (this.pools[id].length < this.poolSize && !this.pools[id].includes(buf)) this.pools[id].push(buf)
+      } else {
+        this.releaseInput(id, buf)
+      }
+    }
+  }
+
   throttle(flowing) {
     //debug('trying to throttle', flowing, this.rasterHighWaterMark, this.ids.map((id) => this.buffersTotalData[id]))
     let id
@@ -10,6 +10,8 @@ const debug = process.env.NODE_DEBUG && process.env.NODE_DEBUG.match(/gdal_read|
  * @property {boolean} [blockOptimize]
  * @property {boolean} [convertNoData]
  * @property {new (len: number) => TypedArray} [type]
+ * @property {number} [pool]
+ * @property {number} [readAhead]
  */
 
 /**
@@ -22,6 +24,8 @@ const debug = process.env.NODE_DEBUG && process.env.NODE_DEBUG.match(/gdal_read|
  * @param {boolean} [options.blockOptimize=true] Read by file blocks when possible (when `rasterSize.x == blockSize.x`)
  * @param {boolean} [options.convertNoData=true] Automatically convert `RasterBand.noDataValue` to `NaN`
  * @param {new (len: number) => TypedArray} [options.readAs=undefined] Data type to convert to, must be a `TypedArray` constructor
+ * @param {number} [options.pool=0] Maximum number of buffers returned with `RasterReadStream.release()` to keep for reuse
+ * @param {number} [options.readAhead=1] Number of reads to keep queued ahead of the consumer
  * @returns {RasterReadStream}
  */
 function createReadStream(options) {
@@ -37,6 +41,23 @@ function createReadStream(options) {
  *
  * Pixels are streamed in row-major order
  *
+ * When the `pool` option is set, buffers that are not needed anymore
+ * can be returned with {@link RasterReadStream.release} and they will be reused
+ * for the following reads instead of allocating new ones
+ *
+ * With `readAhead` set to more than 1, several reads are queued at the same time
+ * so that the decoding of the following blocks continues while the consumer
+ * is processing the current one, this is most useful with compressed rasters
+ * and with datasets opened with the `"p"` flag
+ *
+ * @example
+ *
+ *  const rs = band.pixels.createReadStream({ pool: 16 })
+ *  for await (const chunk of rs) {
+ *    process(chunk)
+ *    rs.release(chunk)
+ *  }
+ *
  * @class RasterReadStream
  * @extends stream.Readable
  * @constructor
@@ -45,6 +66,8 @@ function createReadStream(options) {
  * @param {boolean} [options.blockOptimize=true] Read by file blocks when possible (when `rasterSize.x == blockSize.x`)
  * @param {boolean} [options.convertNoData=false] Automatically convert `RasterBand.noDataValue` to `NaN`, requires float data types
  * @param {new (len: number) => TypedArray} [options.type=undefined] Data type to convert to, must be a `TypedArray` constructor, default is the raster band data type
+ * @param {number} [options.pool=0] Maximum number of buffers returned with `RasterReadStream.release()` to keep for reuse
+ * @param {number} [options.readAhead=1] Number of reads to keep queued ahead of the consumer
  */
 class RasterReadStream extends Readable {
   constructor(options) {
@@ -52,8 +75,26 @@ class RasterReadStream extends Readable {
     this.band = options.band
     this.readingPos = 0
     this.blockPos = 0
-    this.readingInProgress = false
+    this.pending = []
+    this.waitingForData = false
     this.rasterEnded = false
+    this.readAhead = 1
+    this.pool = []
+    this.poolSize = 0
+
+    if (typeof options.readAhead !== 'undefined') {
+      if (!Number.isInteger(options.readAhead) || options.readAhead < 1) {
+        throw new TypeError('"readAhead" must be a positive integer')
+      }
+      this.readAhead = options.readAhead
+    }
+
+    if (typeof options.pool !== 'undefined') {
+      if (typeof options.pool !== 'number' || !(options.pool >= 0)) {
+        throw new TypeError('"pool" must be a non-negative number')
+      }
+      this.poolSize = options.pool
+    }
 
     if (typeof options.type !== 'undefined') {
       try {
@@ -82,6 +123,8 @@ class RasterReadStream extends Readable {
         if (blockSize.x == rasterSize.x && options.blockOptimize !== false) {
           debug('init done, optimized block read', blockSize, rasterSize)
           this._readNextBuffer = RasterReadStream.prototype._readNextBlock
+          this.bufferLength = blockSize.x * blockSize.y
+          this.blockCount = Math.ceil(rasterSize.y / blockSize.y)
           if (options.type) {
             this.arrayConstructor = () => new options.type(blockSize.x * blockSize.y)
           }
@@ -89,6 +132,8 @@ class RasterReadStream extends Readable {
         }
         debug('init done, line by line read', blockSize, rasterSize)
         this._readNextBuffer = RasterReadStream.prototype._readNextLine
+        this.bufferLength = rasterSize.x
+        this.blockCount = rasterSize.y
         if (options.type) {
           this.arrayConstructor = () => new options.type(rasterSize.x)
         }
@@ -103,50 +148,67 @@ RasterReadStream.prototype._doConvertNoData = function (noData, buffer) {
 }
 
 RasterReadStream.prototype._readNext = function () {
-  debug('reading next block', this.readingPos, this.readingInProgress)
-  if (this.readingInProgress || this.rasterEnded) return
-  this.readingInProgress = true
+  debug('reading next block', this.readingPos, this.pending.length)
+  if (this.rasterEnded) return
   this.initQ.then(() => {
-    debug('do read')
-    this._readNextBuffer()
-      .then((data) => {
-        this.readingInProgress = false
-        this._convertNoData(data)
-
-        debug('adding a new buffer', data.length)
-        const flowing = this.push(data)
-        if (this.readingPos == this.rasterSize.y) {
-          debug('raster ended at ', this.readingPos)
-          this.rasterEnded = true
-          this.push(null)
-          return
-        }
-        if (flowing) {
-          this._readNext()
-        } else {
-          debug('push buffer is full')
-        }
-      })
-      .catch((e) => {
-        debug('emitting error', e)
-        this.destroy(e)
-      })
+    // Keep up to readAhead reads queued so that the decoding of the
+    // next blocks overlaps with the consumption of the current one
+    while (this.pending.length < this.readAhead && this.blockPos < this.blockCount) {
+      debug('do read', this.blockPos)
+      const q = this._readNextBuffer(this.blockPos++)
+      // Errors are reported when the buffer reaches the head of the queue
+      q.catch(() => undefined)
+      this.pending.push(q)
+    }
+    this._pushNext()
   })
 }
 
+// Buffers must be pushed in order, the reads complete in any order
+RasterReadStream.prototype._pushNext = function () {
+  if (this.waitingForData || this.pending.length === 0) return
+  this.waitingForData = true
+  this.pending[0]
+    .then((data) => {
+      this.waitingForData = false
+      this.pending.shift()
+      if (this.destroyed) return
+      if (!this.bufferType) this.bufferType = data.constructor
+      this._convertNoData(data)
+      this.readingPos += data.length / this.rasterSize.x
+
+      debug('adding a new buffer', data.length)
+      const flowing = this.push(data)
+      if (this.readingPos == this.rasterSize.y) {
+        debug('raster ended at ', this.readingPos)
+        this.rasterEnded = true
+        this.push(null)
+        return
+      }
+      if (flowing) {
+        this._readNext()
+      } else {
+        debug('push buffer is full')
+      }
+    })
+    .catch((e) => {
+      debug('emitting error', e)
+      this.destroy(e)
+    })
+}
+
 // Optimized reading when horizontally there is only one block (blockSize.x == rasterSize.x)
 // This is more often the case than not
-RasterReadStream.prototype._readNextBlock = function () {
-  const actualSize = this.readingPos + this.blockSize.y > this.rasterSize.y ?
-    this.rasterSize.y - this.readingPos :
+RasterReadStream.prototype._readNextBlock = function (blockPos) {
+  const line = blockPos * this.blockSize.y
+  const actualSize = line + this.blockSize.y > this.rasterSize.y ?
+    this.rasterSize.y - line :
     this.blockSize.y
-  const array = this.arrayConstructor ? this.arrayConstructor() : undefined
-  const dataq = this.band.pixels.readBlockAsync(0, this.blockPos, array)
+  const array = this._allocate()
+  const dataq = this.band.pixels.readBlockAsync(0, blockPos, array)
 
   return dataq
     .then((data) => {
-      this.readingPos += actualSize
-      this.blockPos++
       // Edge blocks, need to be clamped as the data is smaller than the block
       if (actualSize != this.blockSize.y) {
         debug('clamping', this.blockSize, actualSize)
@@ -160,19 +222,46 @@ RasterReadStream.prototype._readNextBlock = function () {
 // GDAL's own block cache handling the block reading
 // If GDAL can fit all the blocks from one horizontal line in its cache
 // this case will be almost as fast as the previous one
-RasterReadStream.prototype._readNextLine = function () {
+RasterReadStream.prototype._readNextLine = function (line) {
   let array
   try {
-    array = this.arrayConstructor ? this.arrayConstructor() : undefined
+    array = this._allocate()
   } catch (e) {
     console.error(e)
   }
-  return this.band.pixels.readAsync(0, this.blockPos, this.rasterSize.x, 1, array)
-    .then((data) => {
-      this.readingPos++
-      this.blockPos++
-      return data
-    })
+  return this.band.pixels.readAsync(0, line, this.rasterSize.x, 1, array)
+}
+
+// Reuse a released buffer when one is available
+RasterReadStream.prototype._allocate = function () {
+  if (this.pool.length > 0) return this.pool.pop()
+  return this.arrayConstructor ? this.arrayConstructor() : undefined
+}
+
+/**
+ * Return a buffer produced by this stream for reuse, requires the `pool` option
+ *
+ * The buffer must not be accessed after it has been released as it
+ * will be overwritten by one of the following reads.
+ *
+ * Buffers that do not come from this stream, including the clamped
+ * edge blocks, are silently ignored if they cannot be reused.
+ *
+ * @method release
+ * @memberof RasterReadStream
+ * @instance
+ * @param {TypedArray} buffer
+ * @returns {void}
+ */
+RasterReadStream.prototype.release = function (buffer) {
+  if (this.pool.length >= this.poolSize || !this.bufferType || !(buffer instanceof this.bufferType)) return
+  // The edge blocks are subarrays of a full block
+  if (buffer.buffer.byteLength !== this.bufferLength * buffer.BYTES_PER_ELEMENT) return
+  if (this.pool.some((b) => b.buffer === buffer.buffer)) return
+  debug('recycling a buffer', this.pool.length)
+  this.pool.push(buffer.byteOffset === 0 && buffer.length === this.bufferLength ?
+    buffer :
+    new this.bufferType(buffer.buffer, 0, this.bufferLength))
 }
 
 RasterReadStream.prototype._read = function () {
@@ -1,8 +1,237 @@
 #include "async.hpp"
 
+#include <algorithm>
+
 namespace node_gdal {
 
 std::thread::id mainV8ThreadId;
+thread_local GDALDataset *currentReader = nullptr;
+AsyncScheduler async_scheduler;
+AsyncThreadPool async_thread_pool;
+
+static inline void sortUnique(std::vector<long> &uids) {
+  std::sort(uids.begin(), uids.end());
+  uids.erase(std::unique(uids.begin(), uids.end()), uids.end());
+  // 0 is not a Dataset, these jobs do not need scheduling
+  if (!uids.empty() && uids.front() == 0) uids.erase(uids.begin());
+}
+
+// A job is runnable when it is at the head of the queue of each of its Datasets
+// and all of these Datasets are idle - or, for a read-only job, have a free handle
+bool AsyncScheduler::tryDispatch(const std::shared_ptr<Task> &task) {
+  for (long uid : task->uids) {
+    auto r = running.find(uid);
+    if (r != running.end()) {
+      // Only read-only jobs can run alongside other read-only jobs, each one on its own reader handle
+      if (!task->readOnly || exclusive.count(uid)) return false;
+      if (r->second >= 1 + object_store.readerCount(uid)) return false;
+    }
+    if (queues[uid].front() != task) return false;
+  }
+  for (long uid : task->uids) {
+    running[uid]++;
+    if (!task->readOnly) exclusive.insert(uid);
+    queues[uid].pop_front();
+    if (queues[uid].empty()) queues.erase(uid);
+  }
+  task->dispatch();
+  return true;
+}
+
+void AsyncScheduler::submit(std::vector<long> uids, bool readOnly, const DispatchFunc &dispatch) {
+  sortUnique(uids);
+  if (uids.empty()) {
+    dispatch();
+    return;
+  }
+  auto task = std::make_shared<Task>(Task{uids, readOnly, dispatch});
+  for (long uid : uids) queues[uid].push_back(task);
+  tryDispatch(task);
+}
+
+void AsyncScheduler::release(std::vector<long> uids, bool readOnly) {
+  sortUnique(uids);
+  for (long uid : uids) {
+    if (!readOnly) exclusive.erase(uid);
+    if (--running[uid] == 0) running.erase(uid);
+  }
+  for (long uid : uids) {
+    // tryDispatch modifies the queue
+    auto q = queues.find(uid);
+    while (q != queues.end() && tryDispatch(q->second.front())) q = queues.find(uid);
+  }
+}
+
+static unsigned defaultThreadPoolSize() {
+  unsigned cores = std::thread::hardware_concurrency();
+  return cores > 0 ? cores : 4;
+}
+
+AsyncThreadPool::AsyncThreadPool()
+  : pending(),
+    completed(),
+    threads(),
+    size(defaultThreadPoolSize()),
+    alive(0),
+    idle(0),
+    stopping(false),
+    complete_signal(nullptr),
+    inflight(0) {
+  uv_mutex_init(&lock);
+  uv_cond_init(&wakeup);
+}
+
+AsyncThreadPool::~AsyncThreadPool() {
+  uv_mutex_destroy(&lock);
+  uv_cond_destroy(&wakeup);
+}
+
+// The main loop of a pool thread
+// The thread exits when the pool is shrunk
+void AsyncThreadPool::ThreadMain(void *arg) {
+  PoolThread *self = static_cast<PoolThread *>(arg);
+  AsyncThreadPool *pool = self->pool;
+
+  uv_mutex_lock(&pool->lock);
+  while (true) {
+    while (pool->pending.empty() && !pool->stopping && pool->alive <= pool->size) {
+      pool->idle++;
+      uv_cond_wait(&pool->wakeup, &pool->lock);
+      pool->idle--;
+    }
+    if (pool->stopping || pool->alive > pool->size) break;
+
+    uv_work_t *req = pool->pending.front();
+    pool->pending.pop_front();
+    uv_mutex_unlock(&pool->lock);
+
+    // This calls GDALAsyncWorker::Execute
+    Nan::AsyncExecute(req);
+
+    uv_mutex_lock(&pool->lock);
+    pool->completed.push_back(req);
+    uv_async_send(pool->complete_signal);
+  }
+  pool->alive--;
+  self->exited = true;
+  uv_mutex_unlock(&pool->lock);
+}
+
+// Back on the main thread, this is the equivalent of the libuv after_work callback
+void AsyncThreadPool::Complete(uv_async_t *handle) {
+  AsyncThreadPool *pool = static_cast<AsyncThreadPool *>(handle->data);
+  std::list<uv_work_t *> done;
+
+  uv_mutex_lock(&pool->lock);
+  done.swap(pool->completed);
+  uv_mutex_unlock(&pool->lock);
+
+  for (uv_work_t *req : done) {
+    pool->inflight--;
+    // This calls GDALAsyncWorker::WorkComplete and deletes the worker
+    Nan::AsyncExecuteComplete(req);
+  }
+  // Do not keep the process alive when there is nothing running
+  if (pool->inflight == 0) uv_unref(reinterpret_cast<uv_handle_t *>(pool->complete_signal));
+}
+
+// Threads are launched on demand, one for each pending job
+// that cannot be picked up by an idle thread
+void AsyncThreadPool::startThreads() {
+  size_t waiting = pending.size() > idle ? pending.size() - idle : 0;
+  while (waiting > 0 && alive < size) {
+    threads.push_back({uv_thread_t(), this, false});
+    if (uv_thread_create(&threads.back().thread, ThreadMain, &threads.back()) != 0) {
+      threads.pop_back();
+      break;
+    }
+    alive++;
+    waiting--;
+  }
+}
+
+// The threads that have left ThreadMain do not hold the lock anymore
+void AsyncThreadPool::joinExited() {
+  for (auto t = threads.begin(); t != threads.end();) {
+    if (t->exited) {
+      uv_thread_join(&t->thread);
+      t = threads.erase(t);
+    } else {
+      t++;
+    }
+  }
+}
+
+void AsyncThreadPool::queue(Nan::AsyncWorker *worker) {
+  if (size == 0) {
+    Nan::AsyncQueueWorker(worker);
+    return;
+  }
+
+  if (complete_signal == nullptr) {
+    complete_signal = new uv_async_t;
+    uv_async_init(Nan::GetCurrentEventLoop(), complete_signal, Complete);
+    complete_signal->data = this;
+  }
+  if (inflight++ == 0) uv_ref(reinterpret_cast<uv_handle_t *>(complete_signal));
+
+  uv_mutex_lock(&lock);
+  pending.push_back(&worker->request);
+  joinExited();
+  startThreads();
+  uv_cond_signal(&wakeup);
+  uv_mutex_unlock(&lock);
+}
+
+void AsyncThreadPool::setSize(unsigned new_size) {
+  std::list<uv_work_t *> orphans;
+
+  uv_mutex_lock(&lock);
+  size = new_size;
+  // The excess threads will exit once they finish their current job
+  uv_cond_broadcast(&wakeup);
+  joinExited();
+  // Nobody will run these, send them to libuv
+  if (size == 0) orphans.swap(pending);
+  // A larger pool can start the jobs that were waiting for a thread
+  startThreads();
+  uv_mutex_unlock(&lock);
+
+  for (uv_work_t *req : orphans) {
+    inflight--;
+    Nan::AsyncQueueWorker(static_cast<Nan::AsyncWorker *>(req->data));
+  }
+  if (complete_signal != nullptr && inflight == 0) uv_unref(reinterpret_cast<uv_handle_t *>(complete_signal));
+}
+
+unsigned AsyncThreadPool::getSize() {
+  return size;
+}
+
+unsigned AsyncThreadPool::getThreads() {
+  uv_mutex_lock(&lock);
+  joinExited();
+  unsigned r = alive;
+  uv_mutex_unlock(&lock);
+  return r;
+}
+
+void AsyncThreadPool::shutdown() {
+  uv_mutex_lock(&lock);
+  stopping = true;
+  uv_cond_broadcast(&wakeup);
+  uv_mutex_unlock(&lock);
+
+  for (PoolThread &t : threads) uv_thread_join(&t.thread);
+  threads.clear();
+
+  if (complete_signal != nullptr) {
+    uv_close(reinterpret_cast<uv_handle_t *>(complete_signal), [](uv_handle_t *handle) {
+      delete reinterpret_cast<uv_async_t *>(handle);
+    });
+    complete_signal = nullptr;
+  }
+}
 
 // *message coming from GDAL points to a statically allocated buffer
 GDALProgressInfo::GDALProgressInfo(double complete, const char *message) : complete(complete), message(message) {
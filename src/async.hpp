@@ -4,6 +4,8 @@
 #include <thread>
 #include <functional>
 #include <chrono>
+#include <list>
+#include <set>
 #include "nan-wrapper.h"
 #include "gdal_common.hpp"
 
@@ -80,25 +82,47 @@ extern std::thread::id mainV8ThreadId;
     return;                                                                                                            \
   }
 
+// The reader handles of a pooled Dataset are opened once and never see
+// the changes made through its main handle
+#define GDAL_POOL_CHECK(uid)                                                                                           \
+  if (object_store.readerCount(uid) > 0) {                                                                             \
+    Nan::ThrowError("Cannot modify a Dataset opened with a pool of handles");                                          \
+    return;                                                                                                            \
+  }
+
 static const char eventLoopWarning[] =
   "Synchronous method called while an asynchronous operation is running in the background, check node_modules/gdal-async/ASYNCIO.md, event loop blocked for ";
+
+// The reader handle used by the read-only job running on this thread
+// nullptr when the job is using the main handle of its Dataset
+extern thread_local GDALDataset *currentReader;
+
+// In a read-only job, these return the object to use for reading
+inline GDALDataset *readerDataset(GDALDataset *ds) {
+  return currentReader != nullptr ? currentReader : ds;
+}
+
+inline GDALRasterBand *readerBand(GDALRasterBand *band) {
+  return currentReader != nullptr ? currentReader->GetRasterBand(band->GetBand()) : band;
+}
+
 // These constructors throw
 // Only one use case never throws: on the main thread
 // and after checking that the Dataset is alive
 class AsyncGuard {
     public:
-  inline AsyncGuard() : lock(nullptr), locks(nullptr) {
+  inline AsyncGuard() : lock(nullptr), locks(nullptr), reader(false) {
   }
-  inline AsyncGuard(long uid) : locks(nullptr) {
+  inline AsyncGuard(long uid) : locks(nullptr), reader(false) {
     lock = object_store.lockDataset(uid);
   }
-  inline AsyncGuard(vector<long> uids) : lock(nullptr), locks(nullptr) {
+  inline AsyncGuard(vector<long> uids) : lock(nullptr), locks(nullptr), reader(false) {
     if (uids.size() == 1)
       lock = object_store.lockDataset(uids[0]);
     else
       locks = make_shared<vector<AsyncLock>>(object_store.lockDatasets(uids));
   }
-  inline AsyncGuard(vector<long> uids, bool warning) : lock(nullptr), locks(nullptr) {
+  inline AsyncGuard(vector<long> uids, bool warning) : lock(nullptr), locks(nullptr), reader(false) {
     if (uids.size() == 1) {
       if (uids[0] == 0) return;
       lock = warning ? object_store.tryLockDataset(uids[0]) : object_store.lockDataset(uids[0]);
@@ -116,7 +140,16 @@ class AsyncGuard {
     if (lock != nullptr) throw "Trying to acquire multiple locks";
     lock = object_store.lockDataset(uid);
   }
+  // Acquire any free handle of the Dataset, sets currentReader
+  inline void acquireReader(long uid) {
+    if (lock != nullptr) throw "Trying to acquire multiple locks";
+    GDALDataset *handle;
+    lock = object_store.lockDatasetReader(uid, handle);
+    currentReader = handle;
+    reader = true;
+  }
   inline ~AsyncGuard() {
+    if (reader) currentReader = nullptr;
     if (lock != nullptr) object_store.unlockDataset(lock);
     if (locks != nullptr) object_store.unlockDatasets(*locks);
   }
@@ -124,8 +157,102 @@ class AsyncGuard {
     private:
   AsyncLock lock;
   shared_ptr<vector<AsyncLock>> locks;
+  bool reader;
 };
 
+// The async job scheduler
+//
+// It keeps a FIFO queue of the pending async jobs of each Dataset
+// and dispatches a job to the thread pool only when none of its
+// Datasets is in use by another async job
+// This way a thread pool slot is never wasted on a worker thread
+// sleeping on the lock of a busy Dataset (see ASYNCIO.md)
+// A Dataset with reader handles can run one read-only job per handle,
+// a job that is not read-only always has the Dataset for itself
+//
+// It lives entirely on the main thread and it does not need locking
+// Synchronous operations still go directly through the Dataset locks
+class AsyncScheduler {
+    public:
+  typedef std::function<void()> DispatchFunc;
+
+  // Enqueue a job, dispatch is called (maybe immediately) once all its Datasets are free
+  void submit(std::vector<long> uids, bool readOnly, const DispatchFunc &dispatch);
+  // Called when a job has finished, dispatches the next runnable jobs
+  void release(std::vector<long> uids, bool readOnly);
+
+    private:
+  struct Task {
+    std::vector<long> uids;
+    bool readOnly;
+    DispatchFunc dispatch;
+  };
+  std::map<long, std::list<std::shared_ptr<Task>>> queues;
+  // The number of running jobs of each Dataset
+  std::map<long, unsigned> running;
+  // The Datasets used by a running job that is not read-only
+  std::set<long> exclusive;
+
+  bool tryDispatch(const std::shared_ptr<Task> &task);
+};
+
+extern AsyncScheduler async_scheduler;
+
+// The GDAL thread pool
+//
+// GDAL jobs are CPU-bound and they are often very long, so by default they
+// run on a dedicated pool of native threads instead of the libuv thread pool
+// which is shared with fs, dns and zlib
+// Execute() runs on the pool threads, while WorkComplete() - and all the JS
+// callbacks - are still delivered on the main thread through an uv_async_t
+//
+// Setting the size to 0 returns to the libuv thread pool
+class AsyncThreadPool {
+    public:
+  AsyncThreadPool();
+  ~AsyncThreadPool();
+
+  // Main thread only
+  void queue(Nan::AsyncWorker *worker);
+  void setSize(unsigned size);
+  unsigned getSize();
+  // The number of running threads, for the unit tests
+  unsigned getThreads();
+  // Called on process exit, joins all the threads
+  void shutdown();
+
+    private:
+  struct PoolThread {
+    uv_thread_t thread;
+    AsyncThreadPool *pool;
+    // Set by the thread when it leaves ThreadMain, it can then be joined
+    bool exited;
+  };
+
+  uv_mutex_t lock;
+  uv_cond_t wakeup;
+  std::list<uv_work_t *> pending;
+  std::list<uv_work_t *> completed;
+  // These are protected by the lock
+  std::list<PoolThread> threads;
+  unsigned size;
+  unsigned alive;
+  unsigned idle;
+  bool stopping;
+  // These are accessed only by the main thread
+  uv_async_t *complete_signal;
+  unsigned inflight;
+
+  // These must be called with the lock held
+  void startThreads();
+  void joinExited();
+
+  static void ThreadMain(void *arg);
+  static void Complete(uv_async_t *handle);
+};
+
+extern AsyncThreadPool async_thread_pool;
+
 // Node.js NAN null initializes and trivially copies objects of this class without asking permission
 struct GDALProgressInfo {
   double complete;
@@ -195,6 +322,7 @@ template <class GDALType> class GDALAsyncWorker : public GDALAsyncProgressWorker
   const GDALMainFunc doit;
   const GDALRValFunc rval;
   const std::vector<long> ds_uids;
+  const bool readOnly;
   GDALType raw;
 
     public:
@@ -204,11 +332,13 @@ template <class GDALType> class GDALAsyncWorker : public GDALAsyncProgressWorker
     const GDALMainFunc &doit,
     const GDALRValFunc &rval,
     const std::map<std::string, v8::Local<v8::Object>> &objects,
-    const std::vector<long> &ds_uids);
+    const std::vector<long> &ds_uids,
+    bool readOnly);
 
   ~GDALAsyncWorker();
 
   void Execute(const ExecutionProgress &progress);
+  void WorkComplete();
   Local<Value> ProduceRVal();
   void HandleProgressCallback(const GDALProgressInfo *data, size_t count);
 };
@@ -220,14 +350,16 @@ GDALAsyncWorker<GDALType>::GDALAsyncWorker(
   const GDALMainFunc &doit,
   const GDALRValFunc &rval,
   const std::map<std::string, v8::Local<v8::Object>> &objects,
-  const std::vector<long> &ds_uids)
+  const std::vector<long> &ds_uids,
+  bool readOnly)
   : GDALAsyncProgressWorker(resultCallback, "node-gdal:GDALAsyncWorker"),
     progressCallback(progressCallback),
     // These members are not references! These functions must be copied
     // as they will be executed in async context!
     doit(doit),
     rval(rval),
-    ds_uids(ds_uids) {
+    ds_uids(ds_uids),
+    readOnly(readOnly) {
   // Main thread with the JS world is not running
   // Get persistent handles
   for (auto i = objects.begin(); i != objects.end(); i++) SaveToPersistent(i->first.c_str(), i->second);
@@ -244,11 +376,24 @@ template <class GDALType> void GDALAsyncWorker<GDALType>::Execute(const Executio
   // V8 objects are not acessible here
   try {
     GDALExecutionProgress executionProgress(&progress);
-    AsyncGuard lock(ds_uids);
-    raw = doit(executionProgress);
+    if (readOnly) {
+      AsyncGuard lock;
+      lock.acquireReader(ds_uids[0]);
+      raw = doit(executionProgress);
+    } else {
+      AsyncGuard lock(ds_uids);
+      raw = doit(executionProgress);
+    }
   } catch (const char *err) { this->SetErrorMessage(err); }
 }
 
+template <class GDALType> void GDALAsyncWorker<GDALType>::WorkComplete() {
+  // Back to the main thread, the Datasets are now free for the next queued job
+  // This must happen before calling JS as the JS callback can throw
+  async_scheduler.release(ds_uids, readOnly);
+  GDALAsyncProgressWorker::WorkComplete();
+}
+
 template <class GDALType> GDALAsyncWorker<GDALType>::~GDALAsyncWorker() {
   if (progressCallback != nullptr) delete progressCallback;
 }
@@ -287,7 +432,16 @@ template <class GDALType> void GDALCallbackWorker<GDALType>::HandleOKCallback()
   // rval is the user function that will create the returned value
   // we give it a lambda that can access the persistent storage created for this operation
   // It uses our HandleScope so it can return a Local without escaping
-  v8::Local<v8::Value> argv[] = {Nan::Null(), this->ProduceRVal()};
+  // rval can fail too, it is then responsible for freeing the GDALType
+  v8::Local<v8::Value> result;
+  try {
+    result = this->ProduceRVal();
+  } catch (const char *err) {
+    v8::Local<v8::Value> argv[] = {Nan::Error(err)};
+    this->callback->Call(1, argv, this->async_resource);
+    return;
+  }
+  v8::Local<v8::Value> argv[] = {Nan::Null(), result};
   this->callback->Call(2, argv, this->async_resource);
 }
 
@@ -314,7 +468,8 @@ template <class GDALType> class GDALPromiseWorker : public GDALAsyncWorker<GDALT
     const GDALMainFunc &doit,
     const GDALRValFunc &rval,
     const std::map<std::string, v8::Local<v8::Object>> &objects,
-    const std::vector<long> &ds_uids);
+    const std::vector<long> &ds_uids,
+    bool readOnly);
 
   ~GDALPromiseWorker();
 
@@ -331,8 +486,9 @@ GDALPromiseWorker<GDALType>::GDALPromiseWorker(
   const GDALMainFunc &doit,
   const GDALRValFunc &rval,
   const std::map<std::string, v8::Local<v8::Object>> &objects,
-  const std::vector<long> &ds_uids)
-  : GDALAsyncWorker<GDALType>(nullptr, nullptr, doit, rval, objects, ds_uids) {
+  const std::vector<long> &ds_uids,
+  bool readOnly)
+  : GDALAsyncWorker<GDALType>(nullptr, nullptr, doit, rval, objects, ds_uids, readOnly) {
   auto context = info.GetIsolate()->GetCurrentContext();
   context_handle = new Nan::Persistent<v8::Context>(context);
   auto resolver = v8::Promise::Resolver::New(context).ToLocalChecked();
@@ -343,7 +499,9 @@ template <class GDALType> void GDALPromiseWorker<GDALType>::HandleOKCallback() {
   Nan::HandleScope scope;
   v8::Local<v8::Context> context = Nan::New(*context_handle);
   v8::Local<v8::Promise::Resolver> resolver = Nan::New(*resolver_handle);
-  resolver->Resolve(context, this->ProduceRVal()).FromJust();
+  try {
+    resolver->Resolve(context, this->ProduceRVal()).FromJust();
+  } catch (const char *err) { resolver->Reject(context, Nan::Error(err)).FromJust(); }
 }
 
 template <class GDALType> void GDALPromiseWorker<GDALType>::HandleErrorCallback() {
@@ -391,10 +549,15 @@ template <class GDALType> class GDALAsyncableJob {
   // This is the lambda that produces the JS return object from the <GDALType> object
   GDALRValFunc rval;
   Nan::Callback *progress;
+  // A read-only job on a single Dataset can run in parallel with other read-only jobs
+  // on one of the reader handles of its Dataset if it has some, main() must then access
+  // the GDAL objects only through readerDataset() / readerBand()
+  bool readOnly;
 
-  GDALAsyncableJob(long ds_uid) : main(), rval(), progress(nullptr), persistent(), ds_uids({ds_uid}), autoIndex(0){};
+  GDALAsyncableJob(long ds_uid)
+    : main(), rval(), progress(nullptr), readOnly(false), persistent(), ds_uids({ds_uid}), autoIndex(0){};
   GDALAsyncableJob(std::vector<long> ds_uids)
-    : main(), rval(), progress(nullptr), persistent(), ds_uids(ds_uids), autoIndex(0){};
+    : main(), rval(), progress(nullptr), readOnly(false), persistent(), ds_uids(ds_uids), autoIndex(0){};
 
   inline void persist(const std::string &key, const v8::Local<v8::Object> &obj) {
     persistent[key] = obj;
@@ -419,7 +582,10 @@ template <class GDALType> class GDALAsyncableJob {
       if (progress) persist("progress_cb", progress->GetFunction());
       Nan::Callback *callback;
       NODE_ARG_CB(cb_arg, "callback", callback);
-      Nan::AsyncQueueWorker(new GDALCallbackWorker<GDALType>(callback, progress, main, rval, persistent, ds_uids));
+      // Reader handles are available only for single Dataset jobs
+      bool reader = readOnly && ds_uids.size() == 1;
+      auto worker = new GDALCallbackWorker<GDALType>(callback, progress, main, rval, persistent, ds_uids, reader);
+      async_scheduler.submit(ds_uids, reader, [worker]() { async_thread_pool.queue(worker); });
       return;
     }
     try {
@@ -435,9 +601,10 @@ template <class GDALType> class GDALAsyncableJob {
   void run(Nan::NAN_GETTER_ARGS_TYPE info, bool async) {
     if (!info.This().IsEmpty() && info.This()->IsObject()) persist("this", info.This());
     if (async) {
-      auto worker = new GDALPromiseWorker<GDALType>(info, main, rval, persistent, ds_uids);
+      bool reader = readOnly && ds_uids.size() == 1;
+      auto worker = new GDALPromiseWorker<GDALType>(info, main, rval, persistent, ds_uids, reader);
       info.GetReturnValue().Set(worker->Promise());
-      Nan::AsyncQueueWorker(worker);
+      async_scheduler.submit(ds_uids, reader, [worker]() { async_thread_pool.queue(worker); });
       return;
     }
     try {
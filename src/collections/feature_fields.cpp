@@ -327,6 +327,7 @@ NAN_METHOD(FeatureFields::indexOf) {
 
 /**
  * Outputs the field data as a pure JS object.
+ * The fields ignored with {@link Layer.setIgnoredFields} are omitted.
  *
  * @throws {Error}
  * @method toObject
@@ -351,6 +352,7 @@ NAN_METHOD(FeatureFields::toObject) {
 
     // get field name
     OGRFieldDefn *field_def = f->get()->GetFieldDefnRef(i);
+    if (field_def->IsIgnored()) continue;
     const char *key = field_def->GetNameRef();
     if (!key) {
       Nan::ThrowError("Error getting field name");
@@ -371,6 +373,7 @@ NAN_METHOD(FeatureFields::toObject) {
 
 /**
  * Outputs the field values as a pure JS array.
+ * The fields ignored with {@link Layer.setIgnoredFields} are omitted.
  *
  * @throws {Error}
  * @method toArray
@@ -389,13 +392,14 @@ NAN_METHOD(FeatureFields::toArray) {
   }
 
   int n = f->get()->GetFieldCount();
-  Local<Array> array = Nan::New<Array>(n);
+  Local<Array> array = Nan::New<Array>();
 
-  for (int i = 0; i < n; i++) {
+  for (int i = 0, j = 0; i < n; i++) {
+    if (f->get()->GetFieldDefnRef(i)->IsIgnored()) continue;
     // get field value
     try {
       Local<Value> val = FeatureFields::get(f->get(), i);
-      Nan::Set(array, i, val);
+      Nan::Set(array, j++, val);
     } catch (const char *err) {
       Nan::ThrowError(err);
       return;
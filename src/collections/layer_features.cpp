@@ -2,6 +2,13 @@
 #include "../gdal_common.hpp"
 #include "../gdal_feature.hpp"
 #include "../gdal_layer.hpp"
+#include "feature_fields.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <ogr_api.h>
 
 namespace node_gdal {
 
@@ -17,10 +24,16 @@ void LayerFeatures::Initialize(Local<Object> target) {
   Nan::SetPrototypeMethod(lcons, "toString", toString);
   Nan__SetPrototypeAsyncableMethod(lcons, "count", count);
   Nan__SetPrototypeAsyncableMethod(lcons, "add", add);
+  Nan__SetPrototypeAsyncableMethod(lcons, "addMany", addMany);
   Nan__SetPrototypeAsyncableMethod(lcons, "get", get);
   Nan__SetPrototypeAsyncableMethod(lcons, "set", set);
   Nan__SetPrototypeAsyncableMethod(lcons, "first", first);
   Nan__SetPrototypeAsyncableMethod(lcons, "next", next);
+  Nan__SetPrototypeAsyncableMethod(lcons, "nextBatch", nextBatch);
+  Nan__SetPrototypeAsyncableMethod(lcons, "nextInto", nextInto);
+  Nan__SetPrototypeAsyncableMethod(lcons, "toObjects", toObjects);
+  Nan__SetPrototypeAsyncableMethod(lcons, "nextGeoJSON", nextGeoJSON);
+  Nan__SetPrototypeAsyncableMethod(lcons, "query", query);
   Nan__SetPrototypeAsyncableMethod(lcons, "remove", remove);
 
   ATTR_DONT_ENUM(lcons, "layer", layerGetter, READ_ONLY_SETTER);
@@ -225,6 +238,515 @@ GDAL_ASYNCABLE_DEFINE(LayerFeatures::next) {
   job.run(info, async, 0);
 }
 
+// Reads up to n features, the main lambda of nextBatch() and toObjects()
+static std::vector<OGRFeature *> readBatch(OGRLayer *gdal_layer, int n) {
+  std::vector<OGRFeature *> features;
+  try {
+    // n can be much larger than the number of features left
+    features.reserve(std::min(n, 4096));
+    while (features.size() < static_cast<size_t>(n)) {
+      OGRFeature *feature = gdal_layer->GetNextFeature();
+      if (feature == nullptr) break;
+      features.push_back(feature);
+    }
+  } catch (const std::bad_alloc &) {
+    for (OGRFeature *feature : features) OGRFeature::DestroyFeature(feature);
+    throw "Out of memory reading the features";
+  }
+  return features;
+}
+
+/**
+ * Returns up to `n` next features in the layer in a single operation.
+ * Returns an empty array if no more features.
+ *
+ * @example
+ *
+ * let batch;
+ * while ((batch = layer.features.nextBatch(1000)).length) { ... }
+ *
+ * @method nextBatch
+ * @instance
+ * @memberof LayerFeatures
+ * @param {number} n Maximum number of features to return
+ * @throws {Error}
+ * @return {Feature[]}
+ */
+
+/**
+ * Returns up to `n` next features in the layer in a single operation.
+ * Returns an empty array if no more features.
+ *
+ * This is much faster than calling `nextAsync()` for every feature as the
+ * features are retrieved in a single asynchronous operation.
+ * @async
+ *
+ * @example
+ *
+ * let batch;
+ * while ((batch = await layer.features.nextBatchAsync(1000)).length) { ... }
+ *
+ * @method nextBatchAsync
+ * @instance
+ * @memberof LayerFeatures
+ * @param {number} n Maximum number of features to return
+ * @param {callback<Feature[]>} [callback=undefined]
+ * @throws {Error}
+ * @return {Promise<Feature[]>}
+ */
+GDAL_ASYNCABLE_DEFINE(LayerFeatures::nextBatch) {
+
+  Local<Object> parent =
+    Nan::GetPrivate(info.This(), Nan::New("parent_").ToLocalChecked()).ToLocalChecked().As<Object>();
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(parent);
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object already destroyed");
+    return;
+  }
+
+  int n;
+  NODE_ARG_INT(0, "n", n);
+  if (n < 1) {
+    Nan::ThrowRangeError("Batch size must be at least 1");
+    return;
+  }
+
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<std::vector<OGRFeature *>> job(layer->parent_uid);
+  job.persist(layer->handle());
+  job.main = [gdal_layer, n](const GDALExecutionProgress &) { return readBatch(gdal_layer, n); };
+  job.rval = [](std::vector<OGRFeature *> features, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    Local<Array> result = Nan::New<Array>(static_cast<int>(features.size()));
+    for (unsigned i = 0; i < features.size(); i++) Nan::Set(result, i, Feature::New(features[i]));
+    return scope.Escape(result);
+  };
+  job.run(info, async, 1);
+}
+
+/**
+ * Reads the next feature of the layer into an existing {@link Feature}
+ * object instead of creating a new one, see {@link LayerFeatures.cursor}.
+ * Returns `false` if no more features, the feature is left unchanged.
+ *
+ * @method nextInto
+ * @instance
+ * @memberof LayerFeatures
+ * @param {Feature} feature The feature to replace
+ * @param {boolean} [reset=false] Restart from the first feature
+ * @throws {Error}
+ * @return {boolean}
+ */
+
+/**
+ * Reads the next feature of the layer into an existing {@link Feature}
+ * object instead of creating a new one, see {@link LayerFeatures.cursor}.
+ * Returns `false` if no more features, the feature is left unchanged.
+ * @async
+ *
+ * @method nextIntoAsync
+ * @instance
+ * @memberof LayerFeatures
+ * @param {Feature} feature The feature to replace
+ * @param {boolean} [reset=false] Restart from the first feature
+ * @param {callback<boolean>} [callback=undefined]
+ * @throws {Error}
+ * @return {Promise<boolean>}
+ */
+GDAL_ASYNCABLE_DEFINE(LayerFeatures::nextInto) {
+
+  Local<Object> parent =
+    Nan::GetPrivate(info.This(), Nan::New("parent_").ToLocalChecked()).ToLocalChecked().As<Object>();
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(parent);
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object already destroyed");
+    return;
+  }
+
+  Feature *f;
+  NODE_ARG_WRAPPED(0, "feature", Feature, f);
+  int reset = 0;
+  NODE_ARG_BOOL_OPT(1, "reset", reset);
+
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<OGRFeature *> job(layer->parent_uid);
+  job.persist(layer->handle());
+  job.persist("feature", info[0].As<Object>());
+  job.main = [gdal_layer, reset](const GDALExecutionProgress &) {
+    if (reset) gdal_layer->ResetReading();
+    return gdal_layer->GetNextFeature();
+  };
+  job.rval = [](OGRFeature *feature, const GetFromPersistentFunc &getter) {
+    if (feature == nullptr) return Nan::False().As<Value>();
+    Feature *f = Nan::ObjectWrap::Unwrap<Feature>(getter("feature").As<Object>());
+    f->reset(feature);
+    return Nan::True().As<Value>();
+  };
+  job.run(info, async, 2);
+}
+
+/**
+ * Returns the field values of up to `n` next features in the layer as
+ * plain JS objects, see {@link FeatureFields.toObject}.
+ * Returns an empty array if no more features.
+ *
+ * This is much faster than calling `fields.toObject()` on every feature as
+ * no `Feature` objects are created and the field names are converted
+ * only once for the whole batch.
+ *
+ * @example
+ *
+ * let batch;
+ * while ((batch = layer.features.toObjects(1000)).length) {
+ *   out.write(batch.map((o) => JSON.stringify(o)).join('\n'));
+ * }
+ *
+ * @method toObjects
+ * @instance
+ * @memberof LayerFeatures
+ * @param {number} n Maximum number of features to return
+ * @throws {Error}
+ * @return {Record<string, any>[]}
+ */
+
+/**
+ * Returns the field values of up to `n` next features in the layer as
+ * plain JS objects, see {@link FeatureFields.toObject}.
+ * Returns an empty array if no more features.
+ * @async
+ *
+ * This is much faster than calling `fields.toObject()` on every feature as
+ * no `Feature` objects are created and the field names are converted
+ * only once for the whole batch.
+ *
+ * @method toObjectsAsync
+ * @instance
+ * @memberof LayerFeatures
+ * @param {number} n Maximum number of features to return
+ * @param {callback<Record<string, any>[]>} [callback=undefined]
+ * @throws {Error}
+ * @return {Promise<Record<string, any>[]>}
+ */
+GDAL_ASYNCABLE_DEFINE(LayerFeatures::toObjects) {
+
+  Local<Object> parent =
+    Nan::GetPrivate(info.This(), Nan::New("parent_").ToLocalChecked()).ToLocalChecked().As<Object>();
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(parent);
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object already destroyed");
+    return;
+  }
+
+  int n;
+  NODE_ARG_INT(0, "n", n);
+  if (n < 1) {
+    Nan::ThrowRangeError("Batch size must be at least 1");
+    return;
+  }
+
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<std::vector<OGRFeature *>> job(layer->parent_uid);
+  job.persist(layer->handle());
+  job.main = [gdal_layer, n](const GDALExecutionProgress &) { return readBatch(gdal_layer, n); };
+  job.rval = [](std::vector<OGRFeature *> features, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    Isolate *isolate = Isolate::GetCurrent();
+    Local<Array> result = Nan::New<Array>(static_cast<int>(features.size()));
+
+    // The keys are internalized once per feature definition and all the
+    // objects are instantiated from the same template so that they share
+    // a single hidden class
+    OGRFeatureDefn *defn = nullptr;
+    std::vector<Local<String>> keys;
+    std::vector<int> idx;
+    Local<ObjectTemplate> shape;
+    for (unsigned i = 0; i < features.size(); i++) {
+      OGRFeature *feature = features[i];
+      if (feature->GetDefnRef() != defn) {
+        defn = feature->GetDefnRef();
+        keys.clear();
+        idx.clear();
+        shape = Nan::New<ObjectTemplate>();
+        for (int j = 0; j < defn->GetFieldCount(); j++) {
+          if (defn->GetFieldDefn(j)->IsIgnored()) continue;
+          const char *name = defn->GetFieldDefn(j)->GetNameRef();
+          idx.push_back(j);
+          keys.push_back(String::NewFromUtf8(isolate, name, NewStringType::kInternalized).ToLocalChecked());
+          shape->Set(keys.back(), Nan::Null());
+        }
+      }
+
+      Local<Object> obj = Nan::NewInstance(shape).ToLocalChecked();
+      try {
+        for (unsigned j = 0; j < keys.size(); j++) Nan::Set(obj, keys[j], FeatureFields::get(feature, idx[j]));
+      } catch (const char *) {
+        // The features have not been handed to JS, nobody else will free them
+        for (unsigned k = i; k < features.size(); k++) OGRFeature::DestroyFeature(features[k]);
+        throw;
+      }
+      Nan::Set(result, i, obj);
+      OGRFeature::DestroyFeature(feature);
+    }
+    return scope.Escape(result);
+  };
+  job.run(info, async, 1);
+}
+
+static void appendJSONString(std::string &out, const char *s) {
+  out += '"';
+  for (; *s; s++) {
+    unsigned char c = static_cast<unsigned char>(*s);
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\r': out += "\\r"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if (c < 0x20) {
+          out += CPLSPrintf("\\u%04x", c);
+        } else {
+          out += *s;
+        }
+    }
+  }
+  out += '"';
+}
+
+static void appendJSONNumber(std::string &out, double v) {
+  if (std::isfinite(v)) {
+    out += CPLSPrintf("%.15g", v);
+  } else {
+    out += "null";
+  }
+}
+
+static void appendJSONField(std::string &out, OGRFeature *f, int i) {
+  if (!f->IsFieldSetAndNotNull(i)) {
+    out += "null";
+    return;
+  }
+  OGRFieldDefn *field_def = f->GetFieldDefnRef(i);
+  int count;
+  switch (field_def->GetType()) {
+    case OFTInteger:
+      if (field_def->GetSubType() == OFSTBoolean) {
+        out += f->GetFieldAsInteger(i) ? "true" : "false";
+      } else {
+        out += std::to_string(f->GetFieldAsInteger(i));
+      }
+      break;
+    case OFTInteger64: out += std::to_string(f->GetFieldAsInteger64(i)); break;
+    case OFTReal: appendJSONNumber(out, f->GetFieldAsDouble(i)); break;
+    case OFTIntegerList: {
+      const int *values = f->GetFieldAsIntegerList(i, &count);
+      out += '[';
+      for (int j = 0; j < count; j++) out += (j ? "," : "") + std::to_string(values[j]);
+      out += ']';
+      break;
+    }
+    case OFTInteger64List: {
+      const GIntBig *values = f->GetFieldAsInteger64List(i, &count);
+      out += '[';
+      for (int j = 0; j < count; j++) out += (j ? "," : "") + std::to_string(values[j]);
+      out += ']';
+      break;
+    }
+    case OFTRealList: {
+      const double *values = f->GetFieldAsDoubleList(i, &count);
+      out += '[';
+      for (int j = 0; j < count; j++) {
+        if (j) out += ',';
+        appendJSONNumber(out, values[j]);
+      }
+      out += ']';
+      break;
+    }
+    case OFTStringList: {
+      char **values = f->GetFieldAsStringList(i);
+      out += '[';
+      for (int j = 0; values && values[j]; j++) {
+        if (j) out += ',';
+        appendJSONString(out, values[j]);
+      }
+      out += ']';
+      break;
+    }
+    default: appendJSONString(out, f->GetFieldAsString(i)); break;
+  }
+}
+
+/**
+ * @typedef {object} GeoJSONOptions
+ * @property {boolean} [ndjson]
+ * @property {number} [precision]
+ * @property {string[]} [fields]
+ */
+
+/**
+ * Returns up to `n` next features in the layer serialized as GeoJSON
+ * `Feature` objects in a `Buffer`, this is the building block of
+ * {@link Layer.createGeoJSONStream}.
+ * Returns `null` if no more features.
+ *
+ * With `ndjson` the features are terminated by a newline, otherwise they
+ * are separated by commas.
+ *
+ * @method nextGeoJSON
+ * @instance
+ * @memberof LayerFeatures
+ * @param {number} n Maximum number of features to return
+ * @param {GeoJSONOptions} [options]
+ * @param {boolean} [options.ndjson=false] Produce newline-delimited GeoJSON
+ * @param {number} [options.precision] Maximum number of decimals of the coordinates
+ * @param {string[]} [options.fields] Fields to include in the properties, all by default
+ * @param {boolean} [options.reset=false] Restart from the first feature
+ * @throws {Error}
+ * @return {Buffer|null}
+ */
+
+/**
+ * Returns up to `n` next features in the layer serialized as GeoJSON
+ * `Feature` objects in a `Buffer`, this is the building block of
+ * {@link Layer.createGeoJSONStream}.
+ * Returns `null` if no more features.
+ * @async
+ *
+ * With `ndjson` the features are terminated by a newline, otherwise they
+ * are separated by commas.
+ *
+ * @method nextGeoJSONAsync
+ * @instance
+ * @memberof LayerFeatures
+ * @param {number} n Maximum number of features to return
+ * @param {GeoJSONOptions} [options]
+ * @param {boolean} [options.ndjson=false] Produce newline-delimited GeoJSON
+ * @param {number} [options.precision] Maximum number of decimals of the coordinates
+ * @param {string[]} [options.fields] Fields to include in the properties, all by default
+ * @param {boolean} [options.reset=false] Restart from the first feature
+ * @param {callback<Buffer|null>} [callback=undefined]
+ * @throws {Error}
+ * @return {Promise<Buffer|null>}
+ */
+GDAL_ASYNCABLE_DEFINE(LayerFeatures::nextGeoJSON) {
+
+  Local<Object> parent =
+    Nan::GetPrivate(info.This(), Nan::New("parent_").ToLocalChecked()).ToLocalChecked().As<Object>();
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(parent);
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object already destroyed");
+    return;
+  }
+
+  int n;
+  NODE_ARG_INT(0, "n", n);
+  if (n < 1) {
+    Nan::ThrowRangeError("Batch size must be at least 1");
+    return;
+  }
+
+  Local<Object> options;
+  bool ndjson = false, reset = false, all_fields = true;
+  int precision = -1;
+  auto fields = std::make_shared<std::vector<std::string>>();
+  NODE_ARG_OBJECT_OPT(1, "options", options);
+  if (!options.IsEmpty()) {
+    ndjson = Nan::To<bool>(Nan::Get(options, Nan::New("ndjson").ToLocalChecked()).ToLocalChecked()).ToChecked();
+    reset = Nan::To<bool>(Nan::Get(options, Nan::New("reset").ToLocalChecked()).ToLocalChecked()).ToChecked();
+    NODE_INT_FROM_OBJ_OPT(options, "precision", precision);
+    Local<Array> fields_array;
+    NODE_ARRAY_FROM_OBJ_OPT(options, "fields", fields_array);
+    if (!fields_array.IsEmpty()) {
+      all_fields = false;
+      for (uint32_t i = 0; i < fields_array->Length(); i++) {
+        Local<Value> name = Nan::Get(fields_array, i).ToLocalChecked();
+        if (!name->IsString()) {
+          Nan::ThrowTypeError("fields must contain only strings");
+          return;
+        }
+        fields->push_back(*Nan::Utf8String(name));
+      }
+    }
+  }
+
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<std::string *> job(layer->parent_uid);
+  job.persist(layer->handle());
+  job.main = [gdal_layer, n, ndjson, reset, precision, all_fields, fields](const GDALExecutionProgress &) {
+    OGRFeatureDefn *defn = gdal_layer->GetLayerDefn();
+    std::vector<int> idx;
+    std::vector<std::string> keys;
+    if (all_fields) {
+      for (int i = 0; i < defn->GetFieldCount(); i++)
+        if (!defn->GetFieldDefn(i)->IsIgnored()) idx.push_back(i);
+    } else {
+      for (const std::string &name : *fields) {
+        int i = defn->GetFieldIndex(name.c_str());
+        if (i < 0) {
+          CPLError(CE_Failure, CPLE_AppDefined, "Field '%s' does not exist", name.c_str());
+          throw CPLGetLastErrorMsg();
+        }
+        idx.push_back(i);
+      }
+    }
+    for (int i : idx) {
+      std::string key;
+      appendJSONString(key, defn->GetFieldDefn(i)->GetNameRef());
+      keys.push_back(key + ":");
+    }
+
+    CPLStringList geom_options;
+    if (precision >= 0) geom_options.SetNameValue("COORDINATE_PRECISION", CPLSPrintf("%d", precision));
+
+    if (reset) gdal_layer->ResetReading();
+    std::string *out = new std::string();
+    int count = 0;
+    OGRFeature *f;
+    while (count < n && (f = gdal_layer->GetNextFeature()) != nullptr) {
+      if (count > 0 && !ndjson) *out += ",\n";
+      *out += "{\"type\":\"Feature\"";
+      if (f->GetFID() != OGRNullFID) *out += ",\"id\":" + std::to_string(f->GetFID());
+      *out += ",\"properties\":{";
+      for (size_t i = 0; i < idx.size(); i++) {
+        if (i) *out += ',';
+        *out += keys[i];
+        appendJSONField(*out, f, idx[i]);
+      }
+      *out += "},\"geometry\":";
+      OGRGeometry *geom = f->GetGeometryRef();
+      char *json = geom ? OGR_G_ExportToJsonEx(OGRGeometry::ToHandle(geom), geom_options.List()) : nullptr;
+      if (json) {
+        *out += json;
+        CPLFree(json);
+      } else {
+        *out += "null";
+      }
+      *out += '}';
+      if (ndjson) *out += '\n';
+      OGRFeature::DestroyFeature(f);
+      count++;
+    }
+
+    if (count == 0) {
+      delete out;
+      return static_cast<std::string *>(nullptr);
+    }
+    return out;
+  };
+  job.rval = [](std::string *out, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    if (out == nullptr) return scope.Escape(Nan::Null().As<Value>());
+    Local<Value> result = Nan::NewBuffer(
+                            const_cast<char *>(out->data()),
+                            out->size(),
+                            [](char *, void *hint) { delete reinterpret_cast<std::string *>(hint); },
+                            out)
+                            .ToLocalChecked();
+    return scope.Escape(result);
+  };
+  job.run(info, async, 2);
+}
+
 /**
  * Adds a feature to the layer. The feature should be created using the current
  * layer as the definition.
@@ -290,6 +812,354 @@ GDAL_ASYNCABLE_DEFINE(LayerFeatures::add) {
   job.run(info, async, 1);
 }
 
+/**
+ * Adds many features to the layer in a single operation.
+ *
+ * The features are inserted in transactions of `commitEvery` features
+ * when the driver supports them, which is much faster with the database
+ * drivers such as GPKG or SQLite. When a feature fails, the current
+ * transaction is rolled back, the previous ones remain committed and
+ * the error message ends with the number of committed features.
+ * With the drivers that do not support transactions such as Shapefile,
+ * all the features before the failing one are written even when
+ * `commitEvery` is `0`.
+ *
+ * @example
+ *
+ * layer.features.addMany(features, { commitEvery: 10000 });
+ *
+ * @method addMany
+ * @instance
+ * @memberof LayerFeatures
+ * @throws {Error}
+ * @param {Feature[]} features
+ * @param {object} [options]
+ * @param {number} [options.commitEvery=0] Number of features per transaction, `0` for a single transaction
+ * @return {number} Number of features added
+ */
+
+/**
+ * Adds many features to the layer in a single operation.
+ * @async
+ *
+ * The features are inserted in transactions of `commitEvery` features
+ * when the driver supports them, which is much faster with the database
+ * drivers such as GPKG or SQLite. When a feature fails, the current
+ * transaction is rolled back, the previous ones remain committed and
+ * the error message ends with the number of committed features.
+ * With the drivers that do not support transactions such as Shapefile,
+ * all the features before the failing one are written even when
+ * `commitEvery` is `0`.
+ *
+ * @method addManyAsync
+ * @instance
+ * @memberof LayerFeatures
+ * @throws {Error}
+ * @param {Feature[]} features
+ * @param {object} [options]
+ * @param {number} [options.commitEvery=0] Number of features per transaction, `0` for a single transaction
+ * @param {callback<number>} [callback=undefined]
+ * @return {Promise<number>}
+ */
+GDAL_ASYNCABLE_DEFINE(LayerFeatures::addMany) {
+
+  Local<Object> parent =
+    Nan::GetPrivate(info.This(), Nan::New("parent_").ToLocalChecked()).ToLocalChecked().As<Object>();
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(parent);
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object already destroyed");
+    return;
+  }
+
+  Local<Array> array;
+  NODE_ARG_ARRAY(0, "features", array);
+
+  Local<Object> options;
+  int commit_every = 0;
+  NODE_ARG_OBJECT_OPT(1, "options", options);
+  if (!options.IsEmpty()) NODE_INT_FROM_OBJ_OPT(options, "commitEvery", commit_every);
+  if (commit_every < 0) {
+    Nan::ThrowRangeError("commitEvery must not be negative");
+    return;
+  }
+
+  auto features = std::make_shared<std::vector<OGRFeature *>>();
+  for (uint32_t i = 0; i < array->Length(); i++) {
+    Local<Value> val = Nan::Get(array, i).ToLocalChecked();
+    if (!val->IsObject() || !Nan::New(Feature::constructor)->HasInstance(val)) {
+      Nan::ThrowTypeError("features must contain only Feature objects");
+      return;
+    }
+    Feature *f = Nan::ObjectWrap::Unwrap<Feature>(val.As<Object>());
+    if (!f->isAlive()) {
+      Nan::ThrowError("Feature object already destroyed");
+      return;
+    }
+    features->push_back(f->get());
+  }
+
+  OGRLayer *gdal_layer = layer->get();
+  GDALDataset *gdal_ds = layer->getParent();
+  GDALAsyncableJob<int> job(layer->parent_uid);
+  job.persist(layer->handle(), array);
+  job.main = [gdal_layer, gdal_ds, features, commit_every](const GDALExecutionProgress &) {
+    size_t total = features->size();
+    size_t step = commit_every > 0 ? static_cast<size_t>(commit_every) : total;
+    // Number of features that remain in the layer if a feature fails
+    size_t committed = 0;
+    for (size_t start = 0; start < total; start += step) {
+      size_t end = std::min(start + step, total);
+      bool transaction = gdal_ds && gdal_ds->StartTransaction(FALSE) == OGRERR_NONE;
+      CPLErrorReset();
+      for (size_t i = start; i < end; i++) {
+        OGRErr err = gdal_layer->CreateFeature((*features)[i]);
+        if (err != OGRERR_NONE) {
+          std::string msg = CPLGetLastErrorType() != CE_None ? CPLGetLastErrorMsg() : getOGRErrMsg(err);
+          // Without a transaction, the previous features of this chunk are already written
+          if (transaction)
+            gdal_ds->RollbackTransaction();
+          else
+            committed = i;
+          CPLError(CE_Failure, CPLE_AppDefined, "%s (%d features committed)", msg.c_str(), static_cast<int>(committed));
+          throw CPLGetLastErrorMsg();
+        }
+      }
+      if (transaction) {
+        OGRErr err = gdal_ds->CommitTransaction();
+        if (err != OGRERR_NONE) {
+          CPLError(
+            CE_Failure, CPLE_AppDefined, "%s (%d features committed)", getOGRErrMsg(err), static_cast<int>(committed));
+          throw CPLGetLastErrorMsg();
+        }
+      }
+      committed = end;
+    }
+    return static_cast<int>(total);
+  };
+  job.rval = [](int count, const GetFromPersistentFunc &) { return Nan::New<Integer>(count); };
+  job.run(info, async, 2);
+}
+
+struct FeatureQueryResult {
+  std::vector<OGRFeature *> features;
+  std::vector<std::vector<int32_t>> windows;
+  bool truncated;
+};
+
+/**
+ * @typedef {object} FeatureQueryOptions
+ * @property {Float64Array} bboxes
+ * @property {string} [where]
+ * @property {string[]} [fields]
+ * @property {number} [limit]
+ */
+
+/**
+ * @typedef {object} FeatureQueryResult
+ * @property {Feature[]} features The features matching at least one window, each feature is returned once
+ * @property {Int32Array[]} windows For each window, the indexes in `features` of its features
+ * @property {boolean} truncated `true` if the `limit` has been reached, the remaining windows are then empty
+ */
+
+/**
+ * Retrieves the features intersecting several windows in a single operation.
+ *
+ * Each feature is returned only once even if it intersects several windows,
+ * `windows[i]` lists the indexes in `features` of the features of window `i`.
+ *
+ * The spatial and the attribute filters and the ignored fields of the layer
+ * are temporarily replaced and they are restored when the operation completes.
+ *
+ * Once `limit` features have been retrieved, the operation stops and sets
+ * `truncated`, the windows that were not fully read are then incomplete.
+ *
+ * @example
+ *
+ * const { features, windows } = layer.features.query({
+ *   bboxes: new Float64Array([ 0, 0, 10, 10, 10, 0, 20, 10 ]),
+ *   where: 'population > 1000'
+ * });
+ *
+ * @method query
+ * @instance
+ * @memberof LayerFeatures
+ * @throws {Error}
+ * @param {FeatureQueryOptions} options
+ * @param {Float64Array} options.bboxes The windows, 4 values per window: `minX, minY, maxX, maxY`
+ * @param {string} [options.where] Attribute filter expression
+ * @param {string[]} [options.fields] Retrieve only these fields, all by default
+ * @param {number} [options.limit] Maximum number of features to retrieve
+ * @return {FeatureQueryResult}
+ */
+
+/**
+ * Retrieves the features intersecting several windows in a single operation.
+ * @async
+ *
+ * Each feature is returned only once even if it intersects several windows,
+ * `windows[i]` lists the indexes in `features` of the features of window `i`.
+ *
+ * The spatial and the attribute filters and the ignored fields of the layer
+ * are temporarily replaced and they are restored when the operation completes.
+ *
+ * Once `limit` features have been retrieved, the operation stops and sets
+ * `truncated`, the windows that were not fully read are then incomplete.
+ *
+ * @method queryAsync
+ * @instance
+ * @memberof LayerFeatures
+ * @throws {Error}
+ * @param {FeatureQueryOptions} options
+ * @param {Float64Array} options.bboxes The windows, 4 values per window: `minX, minY, maxX, maxY`
+ * @param {string} [options.where] Attribute filter expression
+ * @param {string[]} [options.fields] Retrieve only these fields, all by default
+ * @param {number} [options.limit] Maximum number of features to retrieve
+ * @param {callback<FeatureQueryResult>} [callback=undefined]
+ * @return {Promise<FeatureQueryResult>}
+ */
+GDAL_ASYNCABLE_DEFINE(LayerFeatures::query) {
+
+  Local<Object> parent =
+    Nan::GetPrivate(info.This(), Nan::New("parent_").ToLocalChecked()).ToLocalChecked().As<Object>();
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(parent);
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object already destroyed");
+    return;
+  }
+
+  Local<Object> options;
+  NODE_ARG_OBJECT(0, "options", options);
+
+  Local<Value> bboxes_val = Nan::Get(options, Nan::New("bboxes").ToLocalChecked()).ToLocalChecked();
+  if (!bboxes_val->IsFloat64Array()) {
+    Nan::ThrowTypeError("bboxes must be a Float64Array");
+    return;
+  }
+  Nan::TypedArrayContents<double> bboxes_contents(bboxes_val);
+  if (bboxes_contents.length() % 4 != 0) {
+    Nan::ThrowRangeError("bboxes must contain 4 values per window");
+    return;
+  }
+  auto bboxes = std::make_shared<std::vector<double>>(*bboxes_contents, *bboxes_contents + bboxes_contents.length());
+
+  std::string where;
+  int limit = -1;
+  bool all_fields = true;
+  auto fields = std::make_shared<std::vector<std::string>>();
+  NODE_STR_FROM_OBJ_OPT(options, "where", where);
+  NODE_INT_FROM_OBJ_OPT(options, "limit", limit);
+  Local<Array> fields_array;
+  NODE_ARRAY_FROM_OBJ_OPT(options, "fields", fields_array);
+  if (!fields_array.IsEmpty()) {
+    all_fields = false;
+    for (uint32_t i = 0; i < fields_array->Length(); i++) {
+      Local<Value> name = Nan::Get(fields_array, i).ToLocalChecked();
+      if (!name->IsString()) {
+        Nan::ThrowTypeError("fields must contain only strings");
+        return;
+      }
+      fields->push_back(*Nan::Utf8String(name));
+    }
+  }
+
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<FeatureQueryResult> job(layer->parent_uid);
+  job.persist(layer->handle());
+  job.main = [layer, gdal_layer, bboxes, where, limit, all_fields, fields](const GDALExecutionProgress &) {
+    FeatureQueryResult r;
+    r.truncated = false;
+
+    // The state of the layer is saved with the Dataset locked as
+    // the previously queued operations may have changed it
+    CPLStringList saved_ignored;
+    for (const std::string &name : layer->ignored_fields) saved_ignored.AddString(name.c_str());
+    std::string saved_where = layer->attribute_filter;
+    OGRGeometry *filter = gdal_layer->GetSpatialFilter();
+    std::unique_ptr<OGRGeometry> saved_filter(filter != nullptr ? filter->clone() : nullptr);
+    auto cleanup = [gdal_layer, all_fields, &saved_ignored, &saved_where, &saved_filter]() {
+      gdal_layer->SetSpatialFilter(saved_filter.get());
+      gdal_layer->SetAttributeFilter(saved_where.empty() ? nullptr : saved_where.c_str());
+      if (!all_fields) gdal_layer->SetIgnoredFields(const_cast<const char **>(saved_ignored.List()));
+      gdal_layer->ResetReading();
+    };
+
+    if (!all_fields) {
+      OGRFeatureDefn *defn = gdal_layer->GetLayerDefn();
+      CPLStringList ignored;
+      for (int i = 0; i < defn->GetFieldCount(); i++) {
+        const char *name = defn->GetFieldDefn(i)->GetNameRef();
+        if (std::find(fields->begin(), fields->end(), name) == fields->end()) ignored.AddString(name);
+      }
+      for (const std::string &name : *fields) {
+        if (defn->GetFieldIndex(name.c_str()) < 0) {
+          CPLError(CE_Failure, CPLE_AppDefined, "Field '%s' does not exist", name.c_str());
+          throw CPLGetLastErrorMsg();
+        }
+      }
+      gdal_layer->SetIgnoredFields(const_cast<const char **>(ignored.List()));
+    }
+
+    OGRErr err = gdal_layer->SetAttributeFilter(where.empty() ? nullptr : where.c_str());
+    if (err) {
+      cleanup();
+      throw getOGRErrMsg(err);
+    }
+
+    std::map<GIntBig, int32_t> seen;
+    size_t n = bboxes->size() / 4;
+    r.windows.resize(n);
+    for (size_t w = 0; w < n && !r.truncated; w++) {
+      const double *bbox = bboxes->data() + w * 4;
+      gdal_layer->SetSpatialFilterRect(bbox[0], bbox[1], bbox[2], bbox[3]);
+      gdal_layer->ResetReading();
+      OGRFeature *feature;
+      while ((feature = gdal_layer->GetNextFeature()) != nullptr) {
+        GIntBig fid = feature->GetFID();
+        auto it = fid != OGRNullFID ? seen.find(fid) : seen.end();
+        if (it != seen.end()) {
+          r.windows[w].push_back(it->second);
+          OGRFeature::DestroyFeature(feature);
+          continue;
+        }
+        if (limit >= 0 && r.features.size() >= static_cast<size_t>(limit)) {
+          OGRFeature::DestroyFeature(feature);
+          r.truncated = true;
+          break;
+        }
+        int32_t idx = static_cast<int32_t>(r.features.size());
+        r.features.push_back(feature);
+        if (fid != OGRNullFID) seen[fid] = idx;
+        r.windows[w].push_back(idx);
+      }
+    }
+
+    cleanup();
+    return r;
+  };
+  job.rval = [](FeatureQueryResult r, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    Local<Object> result = Nan::New<Object>();
+    Local<Array> features = Nan::New<Array>(static_cast<int>(r.features.size()));
+    for (unsigned i = 0; i < r.features.size(); i++) Nan::Set(features, i, Feature::New(r.features[i]));
+    Local<Array> windows = Nan::New<Array>(static_cast<int>(r.windows.size()));
+    for (unsigned i = 0; i < r.windows.size(); i++) {
+      size_t len = r.windows[i].size();
+      Local<ArrayBuffer> buffer = ArrayBuffer::New(Isolate::GetCurrent(), len * sizeof(int32_t));
+      Local<Int32Array> array = Int32Array::New(buffer, 0, len);
+      if (len > 0) {
+        Nan::TypedArrayContents<int32_t> contents(array);
+        memcpy(*contents, r.windows[i].data(), len * sizeof(int32_t));
+      }
+      Nan::Set(windows, i, array);
+    }
+    Nan::Set(result, Nan::New("features").ToLocalChecked(), features);
+    Nan::Set(result, Nan::New("windows").ToLocalChecked(), windows);
+    Nan::Set(result, Nan::New("truncated").ToLocalChecked(), Nan::New<Boolean>(r.truncated));
+    return scope.Escape(result);
+  };
+  job.run(info, async, 1);
+}
+
 /**
  * Returns the number of features in the layer.
  *
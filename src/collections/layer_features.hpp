@@ -30,8 +30,14 @@ class LayerFeatures : public Nan::ObjectWrap {
   GDAL_ASYNCABLE_DECLARE(get);
   GDAL_ASYNCABLE_DECLARE(first);
   GDAL_ASYNCABLE_DECLARE(next);
+  GDAL_ASYNCABLE_DECLARE(nextBatch);
+  GDAL_ASYNCABLE_DECLARE(nextInto);
+  GDAL_ASYNCABLE_DECLARE(toObjects);
+  GDAL_ASYNCABLE_DECLARE(nextGeoJSON);
+  GDAL_ASYNCABLE_DECLARE(query);
   GDAL_ASYNCABLE_DECLARE(count);
   GDAL_ASYNCABLE_DECLARE(add);
+  GDAL_ASYNCABLE_DECLARE(addMany);
   GDAL_ASYNCABLE_DECLARE(set);
   GDAL_ASYNCABLE_DECLARE(remove);
 
@@ -3,7 +3,11 @@
 #include "../gdal_rasterband.hpp"
 #include "../async.hpp"
 #include "../utils/typed_array.hpp"
+#include "../gdal_spatial_reference.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
 
 namespace node_gdal {
@@ -21,8 +25,11 @@ void RasterBandPixels::Initialize(Local<Object> target) {
   Nan__SetPrototypeAsyncableMethod(lcons, "get", get);
   Nan__SetPrototypeAsyncableMethod(lcons, "set", set);
   Nan__SetPrototypeAsyncableMethod(lcons, "read", read);
+  Nan__SetPrototypeAsyncableMethod(lcons, "readMulti", readMulti);
+  Nan__SetPrototypeAsyncableMethod(lcons, "sample", sample);
   Nan__SetPrototypeAsyncableMethod(lcons, "write", write);
   Nan__SetPrototypeAsyncableMethod(lcons, "readBlock", readBlock);
+  Nan__SetPrototypeAsyncableMethod(lcons, "readBlockRef", readBlockRef);
   Nan__SetPrototypeAsyncableMethod(lcons, "writeBlock", writeBlock);
   Nan__SetPrototypeAsyncableMethod(lcons, "clampBlock", clampBlock);
 
@@ -139,11 +146,12 @@ GDAL_ASYNCABLE_DEFINE(RasterBandPixels::get) {
 
   GDALAsyncableJob<double> job(band->parent_uid);
   job.persist(band->handle());
+  job.readOnly = band->hasReaders();
 
   job.main = [raw, x, y](const GDALExecutionProgress &) {
     double val;
     CPLErrorReset();
-    CPLErr err = raw->RasterIO(GF_Read, x, y, 1, 1, &val, 1, 1, GDT_Float64, 0, 0);
+    CPLErr err = readerBand(raw)->RasterIO(GF_Read, x, y, 1, 1, &val, 1, 1, GDT_Float64, 0, 0);
     if (err) { throw CPLGetLastErrorMsg(); }
     return val;
   };
@@ -203,7 +211,7 @@ GDAL_ASYNCABLE_DEFINE(RasterBandPixels::set) {
   job.run(info, async, 3);
 }
 
-inline GDALRIOResampleAlg parseResamplingAlg(Local<Value> value) {
+GDALRIOResampleAlg parseResamplingAlg(Local<Value> value) {
   if (value->IsUndefined() || value->IsNull()) { return GRIORA_NearestNeighbour; }
   if (!value->IsString()) { throw "resampling property must be a string"; }
   std::string name = *Nan::Utf8String(value);
@@ -403,6 +411,7 @@ GDAL_ASYNCABLE_DEFINE(RasterBandPixels::read) {
   job.persist("array", obj);
   job.persist(band->handle());
   job.progress = cb;
+  job.readOnly = band->hasReaders();
 
   data = (uint8_t *)data + offset * bytes_per_pixel;
   job.main = [gdal_band, x, y, w, h, data, buffer_w, buffer_h, type, pixel_space, line_space, resampling, cb](
@@ -416,8 +425,8 @@ GDAL_ASYNCABLE_DEFINE(RasterBandPixels::read) {
     }
 
     CPLErrorReset();
-    CPLErr err =
-      gdal_band->RasterIO(GF_Read, x, y, w, h, data, buffer_w, buffer_h, type, pixel_space, line_space, extra.get());
+    CPLErr err = readerBand(gdal_band)->RasterIO(
+      GF_Read, x, y, w, h, data, buffer_w, buffer_h, type, pixel_space, line_space, extra.get());
 
     if (err != CE_None) throw CPLGetLastErrorMsg();
     return err;
@@ -427,6 +436,404 @@ GDAL_ASYNCABLE_DEFINE(RasterBandPixels::read) {
   job.run(info, async, 13);
 }
 
+/**
+ * @typedef {object} ReadWindow
+ * @memberof RasterBandPixels
+ * @property {number} x
+ * @property {number} y
+ * @property {number} w
+ * @property {number} h
+ */
+
+/**
+ * @typedef {object} ReadMultiOptions
+ * @memberof RasterBandPixels
+ * @property {string} [data_type]
+ * @property {string} [resampling]
+ */
+
+/**
+ * Reads several regions of pixels at once.
+ *
+ * All the windows are read in a single operation which is more efficient than
+ * calling `read()` for each one of them when they are numerous and small.
+ *
+ * @method readMulti
+ * @instance
+ * @memberof RasterBandPixels
+ * @throws {Error}
+ * @param {ReadWindow[]} windows
+ * @param {ReadMultiOptions} [options]
+ * @param {string} [options.data_type] See {@link GDT|GDT constants}
+ * @param {string} [options.resampling] Resampling algorithm ({@link GRA|available options})
+ * @return {TypedArray[]} A `TypedArray` of values for each window.
+ */
+
+/**
+ * Asynchronously reads several regions of pixels at once.
+ * @async
+ *
+ * All the windows are read in a single background job which is more efficient than
+ * calling `readAsync()` for each one of them when they are numerous and small.
+ *
+ * @method readMultiAsync
+ * @instance
+ * @memberof RasterBandPixels
+ * @param {ReadWindow[]} windows
+ * @param {ReadMultiOptions} [options]
+ * @param {string} [options.data_type] See {@link GDT|GDT constants}
+ * @param {string} [options.resampling] Resampling algorithm ({@link GRA|available options})
+ * @param {callback<TypedArray[]>} [callback=undefined]
+ * @return {Promise<TypedArray[]>} A `TypedArray` of values for each window.
+ */
+struct ReadWindow {
+  int x, y, w, h;
+  void *data;
+};
+
+GDAL_ASYNCABLE_DEFINE(RasterBandPixels::readMulti) {
+
+  RasterBand *band;
+  if ((band = parent(info)) == nullptr) return;
+
+  Local<Array> windows;
+  Local<Object> options;
+  NODE_ARG_ARRAY(0, "windows", windows);
+  NODE_ARG_OBJECT_OPT(1, "options", options);
+
+  GDALDataType type = band->get()->GetRasterDataType();
+  GDALRIOResampleAlg resampling = GRIORA_NearestNeighbour;
+  if (!options.IsEmpty()) {
+    std::string type_name = "";
+    NODE_STR_FROM_OBJ_OPT(options, "data_type", type_name);
+    if (!type_name.empty()) { type = GDALGetDataTypeByName(type_name.c_str()); }
+    Local<String> sym = Nan::New("resampling").ToLocalChecked();
+    if (Nan::HasOwnProperty(options, sym).FromMaybe(false)) {
+      try {
+        resampling = parseResamplingAlg(Nan::Get(options, sym).ToLocalChecked());
+      } catch (const char *e) {
+        Nan::ThrowError(e);
+        return;
+      }
+    }
+  }
+
+  GDALAsyncableJob<CPLErr> job(band->parent_uid);
+  job.persist(band->handle());
+  job.readOnly = band->hasReaders();
+
+  std::vector<ReadWindow> reads;
+  unsigned n = windows->Length();
+  for (unsigned i = 0; i < n; i++) {
+    Local<Value> val = Nan::Get(windows, i).ToLocalChecked();
+    if (!val->IsObject()) {
+      Nan::ThrowTypeError("windows must contain only objects");
+      return;
+    }
+    Local<Object> window = val.As<Object>();
+    ReadWindow r;
+    NODE_INT_FROM_OBJ(window, "x", r.x);
+    NODE_INT_FROM_OBJ(window, "y", r.y);
+    NODE_INT_FROM_OBJ(window, "w", r.w);
+    NODE_INT_FROM_OBJ(window, "h", r.h);
+    if (r.w <= 0 || r.h <= 0) {
+      Nan::ThrowRangeError("Window size must be positive");
+      return;
+    }
+
+    Local<Value> array = TypedArray::New(type, (int64_t)r.w * r.h);
+    if (array.IsEmpty() || !array->IsObject()) {
+      return; // TypedArray::New threw an error
+    }
+    r.data = TypedArray::Validate(array.As<Object>(), type, (int64_t)r.w * r.h);
+    if (!r.data) {
+      return; // TypedArray::Validate threw an error
+    }
+    job.persist(("array" + std::to_string(i)), array.As<Object>());
+    reads.push_back(r);
+  }
+
+  GDALRasterBand *gdal_band = band->get();
+  job.main = [gdal_band, reads, type, resampling](const GDALExecutionProgress &) {
+    GDALRasterIOExtraArg extra;
+    INIT_RASTERIO_EXTRA_ARG(extra);
+    extra.eResampleAlg = resampling;
+    GDALRasterBand *reader = readerBand(gdal_band);
+    int bytes_per_pixel = GDALGetDataTypeSize(type) / 8;
+
+    CPLErrorReset();
+    for (const ReadWindow &r : reads) {
+      CPLErr err = reader->RasterIO(
+        GF_Read, r.x, r.y, r.w, r.h, r.data, r.w, r.h, type, bytes_per_pixel, bytes_per_pixel * r.w, &extra);
+      if (err != CE_None) throw CPLGetLastErrorMsg();
+    }
+    return CE_None;
+  };
+
+  job.rval = [n](CPLErr, const GetFromPersistentFunc &getter) {
+    Nan::EscapableHandleScope scope;
+    Local<Array> result = Nan::New<Array>(n);
+    for (unsigned i = 0; i < n; i++) Nan::Set(result, i, getter(("array" + std::to_string(i)).c_str()));
+    return scope.Escape(result);
+  };
+  job.run(info, async, 2);
+}
+
+// Reads single pixels through the GDAL block cache keeping the last block locked
+// This is much faster than a 1x1 RasterIO when the points are sorted by block
+class PixelSampler {
+    public:
+  PixelSampler(GDALRasterBand *band) : band(band), block(nullptr), bx(-1), by(-1) {
+    band->GetBlockSize(&bw, &bh);
+    type = band->GetRasterDataType();
+    nodata = band->GetNoDataValue(&has_nodata);
+  }
+  ~PixelSampler() {
+    if (block != nullptr) block->DropLock();
+  }
+
+  // Returns false if the pixel is outside the raster or if it is nodata
+  bool get(int col, int row, double &val) {
+    if (col < 0 || row < 0 || col >= band->GetXSize() || row >= band->GetYSize()) return false;
+    int nbx = col / bw, nby = row / bh;
+    if (block == nullptr || nbx != bx || nby != by) {
+      if (block != nullptr) block->DropLock();
+      block = band->GetLockedBlockRef(nbx, nby);
+      if (block == nullptr) throw CPLGetLastErrorMsg();
+      bx = nbx;
+      by = nby;
+    }
+    GByte *data = static_cast<GByte *>(block->GetDataRef()) +
+      ((size_t)(row - by * bh) * bw + (col - bx * bw)) * GDALGetDataTypeSizeBytes(type);
+    GDALCopyWords(data, type, 0, &val, GDT_Float64, 0, 1);
+    if (has_nodata && (val == nodata || (std::isnan(val) && std::isnan(nodata)))) return false;
+    return true;
+  }
+
+    private:
+  GDALRasterBand *band;
+  GDALRasterBlock *block;
+  GDALDataType type;
+  int bw, bh, bx, by;
+  int has_nodata;
+  double nodata;
+};
+
+/**
+ * @typedef {object} SampleOptions
+ * @memberof RasterBandPixels
+ * @property {SpatialReference} [srs]
+ * @property {string} [interpolation]
+ */
+
+/**
+ * @typedef {object} SampleResult
+ * @memberof RasterBandPixels
+ * @property {Float64Array} values
+ * @property {Uint8Array} mask
+ */
+
+/**
+ * Samples the values at many points.
+ *
+ * The coordinates are transformed to pixel coordinates using the geotransform
+ * of the dataset (and the spatial reference if `srs` is given) and then they are
+ * read through the GDAL block cache.
+ *
+ * Points outside of the raster or on nodata pixels have a `NaN` value and
+ * a 0 in the mask, all other points have a 1 in the mask.
+ *
+ * @example
+ *
+ * const { values, mask } = band.pixels.sample(
+ *   new Float64Array([ lon1, lat1, lon2, lat2 ]),
+ *   { srs: gdal.SpatialReference.fromEPSG(4326) });
+ *
+ * @method sample
+ * @instance
+ * @memberof RasterBandPixels
+ * @throws {Error}
+ * @param {Float64Array} coords Interleaved x, y coordinates, always in longitude/latitude or easting/northing order
+ * @param {SampleOptions} [options]
+ * @param {SpatialReference} [options.srs] The spatial reference of the coordinates, the coordinates are in the spatial reference of the dataset if not given
+ * @param {string} [options.interpolation="nearest"] `"nearest"` or `"bilinear"`
+ * @return {SampleResult}
+ */
+
+/**
+ * Asynchronously samples the values at many points.
+ * @async
+ *
+ * The coordinates are transformed to pixel coordinates using the geotransform
+ * of the dataset (and the spatial reference if `srs` is given) and then they are
+ * read through the GDAL block cache in a single background job.
+ *
+ * Points outside of the raster or on nodata pixels have a `NaN` value and
+ * a 0 in the mask, all other points have a 1 in the mask.
+ *
+ * @method sampleAsync
+ * @instance
+ * @memberof RasterBandPixels
+ * @param {Float64Array} coords Interleaved x, y coordinates, always in longitude/latitude or easting/northing order
+ * @param {SampleOptions} [options]
+ * @param {SpatialReference} [options.srs] The spatial reference of the coordinates, the coordinates are in the spatial reference of the dataset if not given
+ * @param {string} [options.interpolation="nearest"] `"nearest"` or `"bilinear"`
+ * @param {callback<SampleResult>} [callback=undefined]
+ * @return {Promise<SampleResult>}
+ */
+GDAL_ASYNCABLE_DEFINE(RasterBandPixels::sample) {
+
+  RasterBand *band;
+  if ((band = parent(info)) == nullptr) return;
+
+  if (info.Length() < 1 || !info[0]->IsFloat64Array()) {
+    Nan::ThrowTypeError("coords must be a Float64Array");
+    return;
+  }
+  Local<Object> coords_obj = info[0].As<Object>();
+  Nan::TypedArrayContents<double> coords_contents(info[0]);
+  if (coords_contents.length() % 2 != 0) {
+    Nan::ThrowError("coords must contain an even number of values");
+    return;
+  }
+  const double *coords = *coords_contents;
+  size_t n = coords_contents.length() / 2;
+
+  Local<Object> options = Nan::New<Object>();
+  NODE_ARG_OBJECT_OPT(1, "options", options);
+
+  SpatialReference *srs = nullptr;
+  NODE_WRAPPED_FROM_OBJ_OPT(options, "srs", SpatialReference, srs);
+  std::shared_ptr<OGRSpatialReference> src_srs;
+  if (srs != nullptr)
+    src_srs = std::shared_ptr<OGRSpatialReference>(srs->get()->Clone(), OGRSpatialReference::DestroySpatialReference);
+
+  std::string interpolation = "nearest";
+  NODE_STR_FROM_OBJ_OPT(options, "interpolation", interpolation);
+  if (interpolation != "nearest" && interpolation != "bilinear") {
+    Nan::ThrowError("interpolation must be \"nearest\" or \"bilinear\"");
+    return;
+  }
+  bool bilinear = interpolation == "bilinear";
+
+  Local<Value> values_array = TypedArray::New(GDT_Float64, n);
+  if (values_array.IsEmpty() || !values_array->IsObject()) {
+    return; // TypedArray::New threw an error
+  }
+  Local<Value> mask_array = TypedArray::New(GDT_Byte, n);
+  if (mask_array.IsEmpty() || !mask_array->IsObject()) {
+    return; // TypedArray::New threw an error
+  }
+  double *values = static_cast<double *>(TypedArray::Validate(values_array.As<Object>(), GDT_Float64, n));
+  uint8_t *mask = static_cast<uint8_t *>(TypedArray::Validate(mask_array.As<Object>(), GDT_Byte, n));
+  if (values == nullptr || mask == nullptr) return;
+
+  GDALRasterBand *gdal_band = band->get();
+  GDALDataset *gdal_ds = band->getParent();
+
+  GDALAsyncableJob<CPLErr> job(band->parent_uid);
+  job.persist(band->handle());
+  job.persist("coords", coords_obj);
+  job.persist("values", values_array.As<Object>());
+  job.persist("mask", mask_array.As<Object>());
+  job.readOnly = band->hasReaders();
+
+  job.main = [gdal_band, gdal_ds, coords, n, values, mask, src_srs, bilinear](const GDALExecutionProgress &) {
+    GDALRasterBand *raw = readerBand(gdal_band);
+    GDALDataset *ds = readerDataset(gdal_ds);
+
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0; i < n; i++) {
+      x[i] = coords[i * 2];
+      y[i] = coords[i * 2 + 1];
+    }
+    std::vector<int> transformed(n, TRUE);
+
+    if (src_srs != nullptr) {
+      OGRSpatialReference dst_srs;
+      OGRChar *wkt = (OGRChar *)ds->GetProjectionRef();
+      if (wkt == nullptr || *wkt == '\0') throw "Dataset does not have a spatial reference";
+      OGRErr err = dst_srs.importFromWkt(&wkt);
+      if (err) throw getOGRErrMsg(err);
+#if GDAL_VERSION_MAJOR >= 3
+      OGRSpatialReference src(*src_srs);
+      src.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+      dst_srs.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+      std::unique_ptr<OGRCoordinateTransformation> ct(OGRCreateCoordinateTransformation(&src, &dst_srs));
+#else
+      std::unique_ptr<OGRCoordinateTransformation> ct(OGRCreateCoordinateTransformation(src_srs.get(), &dst_srs));
+#endif
+      if (ct == nullptr) throw CPLGetLastErrorMsg();
+      ct->Transform((int)n, x.data(), y.data(), nullptr, transformed.data());
+    }
+
+    double gt[6], inv[6];
+    ds->GetGeoTransform(gt);
+    if (!GDALInvGeoTransform(gt, inv)) throw "Dataset geotransform is not invertible";
+    // Overviews have a different resolution than the dataset
+    double sx = (double)raw->GetXSize() / ds->GetRasterXSize();
+    double sy = (double)raw->GetYSize() / ds->GetRasterYSize();
+
+    std::vector<double> px(n), py(n);
+    std::vector<size_t> order;
+    order.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+      values[i] = std::numeric_limits<double>::quiet_NaN();
+      mask[i] = 0;
+      if (!transformed[i]) continue;
+      px[i] = (inv[0] + inv[1] * x[i] + inv[2] * y[i]) * sx;
+      py[i] = (inv[3] + inv[4] * x[i] + inv[5] * y[i]) * sy;
+      if (!(px[i] >= 0 && py[i] >= 0 && px[i] < raw->GetXSize() && py[i] < raw->GetYSize())) continue;
+      order.push_back(i);
+    }
+
+    // Read the points block by block
+    int bw, bh;
+    raw->GetBlockSize(&bw, &bh);
+    auto blockOf = [&px, &py, bw, bh, raw](size_t i) {
+      return (int64_t)(py[i] / bh) * ((raw->GetXSize() + bw - 1) / bw) + (int64_t)(px[i] / bw);
+    };
+    std::sort(order.begin(), order.end(), [&blockOf](size_t a, size_t b) { return blockOf(a) < blockOf(b); });
+
+    CPLErrorReset();
+    PixelSampler sampler(raw);
+    for (size_t i : order) {
+      if (!bilinear) {
+        double v;
+        if (sampler.get((int)px[i], (int)py[i], v)) {
+          values[i] = v;
+          mask[i] = 1;
+        }
+        continue;
+      }
+      // Bilinear interpolation between the centers of the 4 nearest pixels
+      double fx = px[i] - 0.5, fy = py[i] - 0.5;
+      int x0 = (int)std::floor(fx), y0 = (int)std::floor(fy);
+      double wx = fx - x0, wy = fy - y0;
+      int x1 = std::min(x0 + 1, raw->GetXSize() - 1), y1 = std::min(y0 + 1, raw->GetYSize() - 1);
+      x0 = std::max(x0, 0);
+      y0 = std::max(y0, 0);
+      double v00, v10, v01, v11;
+      if (
+        sampler.get(x0, y0, v00) && sampler.get(x1, y0, v10) && sampler.get(x0, y1, v01) &&
+        sampler.get(x1, y1, v11)) {
+        values[i] = (v00 * (1 - wx) + v10 * wx) * (1 - wy) + (v01 * (1 - wx) + v11 * wx) * wy;
+        mask[i] = 1;
+      }
+    }
+    return CE_None;
+  };
+
+  job.rval = [](CPLErr, const GetFromPersistentFunc &getter) {
+    Nan::EscapableHandleScope scope;
+    Local<Object> result = Nan::New<Object>();
+    Nan::Set(result, Nan::New("values").ToLocalChecked(), getter("values"));
+    Nan::Set(result, Nan::New("mask").ToLocalChecked(), getter("mask"));
+    return scope.Escape(result);
+  };
+  job.run(info, async, 2);
+}
+
 /**
  * @typedef {object} WriteOptions
  * @memberof RasterBandPixels
@@ -629,9 +1036,10 @@ GDAL_ASYNCABLE_DEFINE(RasterBandPixels::readBlock) {
   GDALAsyncableJob<CPLErr> job(band->parent_uid);
   job.persist("array", obj);
   job.persist(band->handle());
+  job.readOnly = band->hasReaders();
   job.main = [gdal_band, x, y, data](const GDALExecutionProgress &) {
     CPLErrorReset();
-    CPLErr err = gdal_band->ReadBlock(x, y, data);
+    CPLErr err = readerBand(gdal_band)->ReadBlock(x, y, data);
     if (err) { throw CPLGetLastErrorMsg(); }
     return err;
   };
@@ -639,6 +1047,111 @@ GDAL_ASYNCABLE_DEFINE(RasterBandPixels::readBlock) {
   job.run(info, async, 3);
 }
 
+// Called by Node.js when the ArrayBuffer of a pinned block is garbage collected
+static void releasePinnedBlock(char *, void *hint) {
+  std::shared_ptr<PinnedBlock> *pin = static_cast<std::shared_ptr<PinnedBlock> *>(hint);
+  object_store.unpinBlock(*pin);
+  delete pin;
+}
+
+/**
+ * Returns a block of pixels without copying it.
+ *
+ * The returned `TypedArray` points directly to the memory of the block in the
+ * GDAL block cache. The block remains locked in the cache until the array is
+ * garbage collected. Closing the dataset detaches the array, flushing the dataset
+ * or the band is not possible while the array is referenced.
+ *
+ * The array must be considered read-only, writing to it has undefined results.
+ * Pinning too many blocks can exhaust the GDAL block cache (`GDAL_CACHEMAX`).
+ *
+ * @method readBlockRef
+ * @instance
+ * @memberof RasterBandPixels
+ * @throws {Error}
+ * @param {number} x
+ * @param {number} y
+ * @return {TypedArray} A `TypedArray` of values.
+ */
+
+/**
+ * Returns a block of pixels without copying it.
+ * @async
+ *
+ * The returned `TypedArray` points directly to the memory of the block in the
+ * GDAL block cache. The block remains locked in the cache until the array is
+ * garbage collected. Closing the dataset detaches the array, flushing the dataset
+ * or the band is not possible while the array is referenced.
+ *
+ * The array must be considered read-only, writing to it has undefined results.
+ * Pinning too many blocks can exhaust the GDAL block cache (`GDAL_CACHEMAX`).
+ *
+ * @method readBlockRefAsync
+ * @instance
+ * @memberof RasterBandPixels
+ * @param {number} x
+ * @param {number} y
+ * @param {callback<TypedArray>} [callback=undefined]
+ * @return {Promise<TypedArray>} A `TypedArray` of values.
+ */
+GDAL_ASYNCABLE_DEFINE(RasterBandPixels::readBlockRef) {
+
+  RasterBand *band;
+  if ((band = parent(info)) == nullptr) return;
+
+  int x, y, w = 0, h = 0;
+  NODE_ARG_INT(0, "block_x_offset", x);
+  NODE_ARG_INT(1, "block_y_offset", y);
+
+  band->get()->GetBlockSize(&w, &h);
+  int64_t size = (int64_t)w * h;
+  GDALDataType type = band->get()->GetRasterDataType();
+  long ds_uid = band->parent_uid;
+
+  GDALRasterBand *gdal_band = band->get();
+  std::shared_ptr<DatasetResources> resources;
+  try {
+    resources = object_store.getResources(ds_uid);
+  } catch (const char *msg) {
+    Nan::ThrowError(msg);
+    return;
+  }
+
+  GDALAsyncableJob<std::shared_ptr<PinnedBlock>> job(ds_uid);
+  job.persist("band", band->handle());
+  job.readOnly = band->hasReaders();
+  job.main = [gdal_band, x, y, resources](const GDALExecutionProgress &) {
+    CPLErrorReset();
+    GDALRasterBlock *block = readerBand(gdal_band)->GetLockedBlockRef(x, y);
+    if (block == nullptr) { throw CPLGetLastErrorMsg(); }
+    std::shared_ptr<PinnedBlock> pin = std::make_shared<PinnedBlock>();
+    pin->block = block;
+    pin->resources = resources;
+    pin->released = false;
+    object_store.pinBlock(pin);
+    return pin;
+  };
+  job.rval = [type, size](std::shared_ptr<PinnedBlock> pin, const GetFromPersistentFunc &getter) {
+    Nan::EscapableHandleScope scope;
+    // The Dataset has been closed before we got here
+    if (pin->released) throw "Parent Dataset object has already been destroyed";
+    Local<Value> array;
+    std::shared_ptr<PinnedBlock> *hint = new std::shared_ptr<PinnedBlock>(pin);
+    try {
+      array = TypedArray::New(type, pin->block->GetDataRef(), size, releasePinnedBlock, hint);
+    } catch (const char *) {
+      releasePinnedBlock(nullptr, hint);
+      throw;
+    }
+    // The array keeps the band and the Dataset alive
+    Nan::SetPrivate(array.As<Object>(), Nan::New("band_").ToLocalChecked(), getter("band"));
+    pin->array_buffer.Reset(v8::Isolate::GetCurrent(), array.As<v8::TypedArray>()->Buffer());
+    pin->array_buffer.SetWeak();
+    return scope.Escape(array);
+  };
+  job.run(info, async, 2);
+}
+
 /**
  * Writes a block of pixels.
  *
@@ -19,6 +19,9 @@ using namespace node;
 
 namespace node_gdal {
 
+// Also used by Dataset::read, throws on invalid values
+GDALRIOResampleAlg parseResamplingAlg(Local<Value> value);
+
 class RasterBandPixels : public Nan::ObjectWrap {
     public:
   static Nan::Persistent<FunctionTemplate> constructor;
@@ -31,8 +34,11 @@ class RasterBandPixels : public Nan::ObjectWrap {
   GDAL_ASYNCABLE_DECLARE(get);
   GDAL_ASYNCABLE_DECLARE(set);
   GDAL_ASYNCABLE_DECLARE(read);
+  GDAL_ASYNCABLE_DECLARE(readMulti);
+  GDAL_ASYNCABLE_DECLARE(sample);
   GDAL_ASYNCABLE_DECLARE(write);
   GDAL_ASYNCABLE_DECLARE(readBlock);
+  GDAL_ASYNCABLE_DECLARE(readBlockRef);
   GDAL_ASYNCABLE_DECLARE(writeBlock);
   GDAL_ASYNCABLE_DECLARE(clampBlock);
 
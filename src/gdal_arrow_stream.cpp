@@ -0,0 +1,370 @@
+#include "gdal_arrow_stream.hpp"
+#include "gdal_common.hpp"
+#include "gdal_layer.hpp"
+
+#include <cstring>
+
+namespace node_gdal {
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+
+Nan::Persistent<FunctionTemplate> ArrowStream::constructor;
+
+void ArrowStream::Initialize(Local<Object> target) {
+  Nan::HandleScope scope;
+
+  Local<FunctionTemplate> lcons = Nan::New<FunctionTemplate>(ArrowStream::New);
+  lcons->InstanceTemplate()->SetInternalFieldCount(1);
+  lcons->SetClassName(Nan::New("ArrowStream").ToLocalChecked());
+
+  Nan::SetPrototypeMethod(lcons, "toString", toString);
+  Nan::SetPrototypeMethod(lcons, "close", close);
+  Nan__SetPrototypeAsyncableMethod(lcons, "next", next);
+
+  ATTR_DONT_ENUM(lcons, "layer", layerGetter, READ_ONLY_SETTER);
+
+  Nan::Set(target, Nan::New("ArrowStream").ToLocalChecked(), Nan::GetFunction(lcons).ToLocalChecked());
+
+  constructor.Reset(lcons);
+}
+
+ArrowStream::ArrowStream() : Nan::ObjectWrap(), parent_uid(0), handle(nullptr), resources(nullptr) {
+}
+
+ArrowStream::~ArrowStream() {
+  dispose();
+}
+
+// Called by the GC, it must not sleep on the Dataset lock
+// If the Dataset is busy, the stream will be released when the Dataset is closed
+void ArrowStream::dispose() {
+  if (handle != nullptr && !handle->released) {
+    try {
+      AsyncLock lock = object_store.tryLockDataset(parent_uid);
+      if (lock != nullptr) {
+        object_store.releaseArrowStream(resources, handle);
+        object_store.unlockDataset(lock);
+      }
+    } catch (const char *) {
+      // The Dataset has already been closed and the stream has been released with it
+    }
+  }
+  handle = nullptr;
+  resources = nullptr;
+}
+
+/**
+ * A stream of Arrow record batches retrieved from a {@link Layer}
+ * with `Layer.getArrowStream()`.
+ *
+ * Each batch is an object containing the number of features in the batch
+ * and one column object per field with the values in a `TypedArray`.
+ * The geometries are returned in a binary column with WKB values by default.
+ *
+ * Columns of unsupported types (lists, structures, dictionaries, decimals,
+ * half-precision floats and fixed-size binaries) are not returned.
+ *
+ * The stream is released when all the batches have been read,
+ * when it is closed or when the dataset is closed.
+ *
+ * @example
+ *
+ * const stream = await layer.getArrowStreamAsync({ MAX_FEATURES_IN_BATCH: 1000 });
+ * for await (const batch of stream) {
+ *   const population = batch.columns.population.values;
+ *   for (let i = 0; i < batch.length; i++) { ... }
+ * }
+ *
+ * @class ArrowStream
+ */
+NAN_METHOD(ArrowStream::New) {
+
+  if (!info.IsConstructCall()) {
+    Nan::ThrowError("Cannot call constructor as function, you need to use 'new' keyword");
+    return;
+  }
+
+  if (info[0]->IsExternal()) {
+    Local<External> ext = info[0].As<External>();
+    void *ptr = ext->Value();
+    ArrowStream *f = static_cast<ArrowStream *>(ptr);
+    f->Wrap(info.This());
+    info.GetReturnValue().Set(info.This());
+    return;
+  } else {
+    Nan::ThrowError("Cannot create ArrowStream directly, use Layer.getArrowStream()");
+    return;
+  }
+}
+
+Local<Value> ArrowStream::New(
+  std::shared_ptr<ArrowStreamHandle> handle,
+  std::shared_ptr<DatasetResources> resources,
+  Local<Object> layer,
+  long parent_uid) {
+  Nan::EscapableHandleScope scope;
+
+  ArrowStream *wrapped = new ArrowStream();
+  wrapped->handle = handle;
+  wrapped->resources = resources;
+  wrapped->parent_uid = parent_uid;
+
+  Local<Value> ext = Nan::New<External>(wrapped);
+  Local<Object> obj =
+    Nan::NewInstance(Nan::GetFunction(Nan::New(ArrowStream::constructor)).ToLocalChecked(), 1, &ext).ToLocalChecked();
+  // The stream keeps the Layer and the Dataset alive
+  Nan::SetPrivate(obj, Nan::New("layer_").ToLocalChecked(), layer);
+
+  return scope.Escape(obj);
+}
+
+NAN_METHOD(ArrowStream::toString) {
+  info.GetReturnValue().Set(Nan::New("ArrowStream").ToLocalChecked());
+}
+
+/**
+ * Releases the stream before reading all the batches.
+ *
+ * @method close
+ * @instance
+ * @memberof ArrowStream
+ * @return {void}
+ */
+NAN_METHOD(ArrowStream::close) {
+  ArrowStream *stream = Nan::ObjectWrap::Unwrap<ArrowStream>(info.This());
+  if (stream->handle == nullptr || stream->handle->released) return;
+  if (!object_store.isAlive(stream->parent_uid)) return;
+
+  AsyncGuard lock({stream->parent_uid}, eventLoopWarn);
+  object_store.releaseArrowStream(stream->resources, stream->handle);
+}
+
+// The TypedArray types are designated by their Arrow format character
+static size_t typeSize(char type) {
+  switch (type) {
+    case 'c':
+    case 'C': return 1;
+    case 's':
+    case 'S': return 2;
+    case 'i':
+    case 'I':
+    case 'f': return 4;
+    default: return 8;
+  }
+}
+
+// Creates a TypedArray of the given type with a copy of the data
+static Local<Value> newTypedArray(char type, const void *data, size_t length) {
+  Nan::EscapableHandleScope scope;
+  size_t size = typeSize(type);
+  Local<ArrayBuffer> buffer = ArrayBuffer::New(v8::Isolate::GetCurrent(), length * size);
+  Local<v8::TypedArray> array;
+  switch (type) {
+    case 'c': array = Int8Array::New(buffer, 0, length); break;
+    case 'C': array = Uint8Array::New(buffer, 0, length); break;
+    case 's': array = Int16Array::New(buffer, 0, length); break;
+    case 'S': array = Uint16Array::New(buffer, 0, length); break;
+    case 'i': array = Int32Array::New(buffer, 0, length); break;
+    case 'I': array = Uint32Array::New(buffer, 0, length); break;
+    case 'f': array = Float32Array::New(buffer, 0, length); break;
+    case 'g': array = Float64Array::New(buffer, 0, length); break;
+    case 'l': array = BigInt64Array::New(buffer, 0, length); break;
+    case 'L': array = BigUint64Array::New(buffer, 0, length); break;
+  }
+  if (data != nullptr && length > 0) {
+    Nan::TypedArrayContents<uint8_t> contents(array);
+    memcpy(*contents, data, length * size);
+  }
+  return scope.Escape(array);
+}
+
+static inline bool getBit(const void *bitmap, int64_t i) {
+  return (static_cast<const uint8_t *>(bitmap)[i >> 3] >> (i & 7)) & 1;
+}
+
+// Returns the TypedArray type used for the values of a fixed-width Arrow format
+// or 0 if this format is not supported
+static char fixedWidthType(const std::string &format) {
+  if (format.size() == 1) {
+    switch (format[0]) {
+      case 'c':
+      case 'C':
+      case 's':
+      case 'S':
+      case 'i':
+      case 'I':
+      case 'l':
+      case 'L':
+      case 'f':
+      case 'g': return format[0];
+    }
+    return 0;
+  }
+  // dates, times, timestamps and durations
+  if (format == "tdD" || format == "tts" || format == "ttm") return 'i';
+  if (format == "tdm" || format == "ttu" || format == "ttn") return 'l';
+  if (format.compare(0, 2, "ts") == 0 || format.compare(0, 2, "tD") == 0) return 'l';
+  return 0;
+}
+
+// Converts one column of a record batch, returns undefined for unsupported types
+static Local<Value> columnToJS(const ArrowColumn &column, const struct ArrowArray *array, int64_t offset, int64_t length) {
+  Nan::EscapableHandleScope scope;
+  const std::string &format = column.format;
+  if (column.dictionary) return scope.Escape(Nan::Undefined());
+
+  Local<Object> result = Nan::New<Object>();
+  Nan::Set(result, Nan::New("type").ToLocalChecked(), SafeString::New(format.c_str()));
+
+  offset += array->offset;
+  char type = fixedWidthType(format);
+  if (type) {
+    size_t size = typeSize(type);
+    const uint8_t *values = static_cast<const uint8_t *>(array->buffers[1]);
+    Nan::Set(
+      result, Nan::New("values").ToLocalChecked(), newTypedArray(type, values + offset * size, (size_t)length));
+  } else if (format == "b") {
+    Local<Value> values = newTypedArray('C', nullptr, (size_t)length);
+    Nan::TypedArrayContents<uint8_t> contents(values);
+    for (int64_t i = 0; i < length; i++) (*contents)[i] = getBit(array->buffers[1], offset + i);
+    Nan::Set(result, Nan::New("values").ToLocalChecked(), values);
+  } else if (format == "u" || format == "z") {
+    const int32_t *offsets = static_cast<const int32_t *>(array->buffers[1]) + offset;
+    const uint8_t *data = static_cast<const uint8_t *>(array->buffers[2]);
+    Local<Value> js_offsets = newTypedArray('i', nullptr, (size_t)length + 1);
+    Nan::TypedArrayContents<int32_t> contents(js_offsets);
+    for (int64_t i = 0; i <= length; i++) (*contents)[i] = offsets[i] - offsets[0];
+    Nan::Set(result, Nan::New("offsets").ToLocalChecked(), js_offsets);
+    Nan::Set(
+      result,
+      Nan::New("values").ToLocalChecked(),
+      newTypedArray('C', data + offsets[0], (size_t)(offsets[length] - offsets[0])));
+  } else if (format == "U" || format == "Z") {
+    const int64_t *offsets = static_cast<const int64_t *>(array->buffers[1]) + offset;
+    const uint8_t *data = static_cast<const uint8_t *>(array->buffers[2]);
+    Local<Value> js_offsets = newTypedArray('l', nullptr, (size_t)length + 1);
+    Nan::TypedArrayContents<int64_t> contents(js_offsets);
+    for (int64_t i = 0; i <= length; i++) (*contents)[i] = offsets[i] - offsets[0];
+    Nan::Set(result, Nan::New("offsets").ToLocalChecked(), js_offsets);
+    Nan::Set(
+      result,
+      Nan::New("values").ToLocalChecked(),
+      newTypedArray('C', data + offsets[0], (size_t)(offsets[length] - offsets[0])));
+  } else {
+    return scope.Escape(Nan::Undefined());
+  }
+
+  if (array->null_count != 0 && array->buffers[0] != nullptr) {
+    Local<Value> validity = newTypedArray('C', nullptr, (size_t)length);
+    Nan::TypedArrayContents<uint8_t> contents(validity);
+    for (int64_t i = 0; i < length; i++) (*contents)[i] = getBit(array->buffers[0], offset + i);
+    Nan::Set(result, Nan::New("validity").ToLocalChecked(), validity);
+  } else {
+    Nan::Set(result, Nan::New("validity").ToLocalChecked(), Nan::Null());
+  }
+
+  return scope.Escape(result);
+}
+
+// Record batches are independent of their stream, they can be converted after the Dataset has been closed
+static void releaseArrowArray(struct ArrowArray *array) {
+  if (array->release != nullptr) array->release(array);
+  delete array;
+}
+
+/**
+ * @typedef {object} ArrowColumn
+ * @property {string} type Arrow format string of the column
+ * @property {Int8Array|Uint8Array|Int16Array|Uint16Array|Int32Array|Uint32Array|BigInt64Array|BigUint64Array|Float32Array|Float64Array} values Values of the column, for strings and binaries (WKB geometries) these are the bytes of all the values
+ * @property {Int32Array|BigInt64Array} [offsets] For strings and binaries only, value `i` is `values[offsets[i]...offsets[i+1]]`
+ * @property {Uint8Array|null} validity `0` for null values or `null` if there are no null values
+ */
+
+/**
+ * @typedef {object} ArrowRecordBatch
+ * @property {number} length Number of features in the batch
+ * @property {Record<string, ArrowColumn>} columns
+ */
+
+/**
+ * Returns the next record batch or `null` when there are no more batches.
+ *
+ * @method next
+ * @instance
+ * @memberof ArrowStream
+ * @throws {Error}
+ * @return {ArrowRecordBatch|null}
+ */
+
+/**
+ * Returns the next record batch or `null` when there are no more batches.
+ * @async
+ *
+ * @method nextAsync
+ * @instance
+ * @memberof ArrowStream
+ * @param {callback<ArrowRecordBatch|null>} [callback=undefined]
+ * @throws {Error}
+ * @return {Promise<ArrowRecordBatch|null>}
+ */
+GDAL_ASYNCABLE_DEFINE(ArrowStream::next) {
+  ArrowStream *stream = Nan::ObjectWrap::Unwrap<ArrowStream>(info.This());
+  if (stream->handle == nullptr || !object_store.isAlive(stream->parent_uid)) {
+    Nan::ThrowError("ArrowStream has already been released");
+    return;
+  }
+
+  std::shared_ptr<ArrowStreamHandle> handle = stream->handle;
+  std::shared_ptr<DatasetResources> resources = stream->resources;
+
+  GDALAsyncableJob<std::shared_ptr<struct ArrowArray>> job(stream->parent_uid);
+  job.persist(info.This());
+  job.main = [handle, resources](const GDALExecutionProgress &) {
+    std::shared_ptr<struct ArrowArray> batch(new struct ArrowArray, releaseArrowArray);
+    memset(batch.get(), 0, sizeof(struct ArrowArray));
+    if (handle->released) return std::shared_ptr<struct ArrowArray>(nullptr);
+    if (handle->stream.get_next(&handle->stream, batch.get()) != 0) {
+      const char *msg = handle->stream.get_last_error(&handle->stream);
+      CPLError(CE_Failure, CPLE_AppDefined, "%s", msg ? msg : "Failed reading the next Arrow batch");
+      throw CPLGetLastErrorMsg();
+    }
+    if (batch->release == nullptr) {
+      // End of stream
+      object_store.releaseArrowStream(resources, handle);
+      return std::shared_ptr<struct ArrowArray>(nullptr);
+    }
+    return batch;
+  };
+  job.rval = [handle](std::shared_ptr<struct ArrowArray> batch, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    if (batch == nullptr) return scope.Escape(Nan::Null().As<Value>());
+
+    Local<Object> result = Nan::New<Object>();
+    Local<Object> columns = Nan::New<Object>();
+    Nan::Set(result, Nan::New("length").ToLocalChecked(), Nan::New<Number>(static_cast<double>(batch->length)));
+    for (size_t i = 0; i < handle->columns.size() && i < static_cast<size_t>(batch->n_children); i++) {
+      Local<Value> column = columnToJS(handle->columns[i], batch->children[i], batch->offset, batch->length);
+      if (!column->IsUndefined())
+        Nan::Set(columns, SafeString::New(handle->columns[i].name.c_str()), column);
+    }
+    Nan::Set(result, Nan::New("columns").ToLocalChecked(), columns);
+    return scope.Escape(result.As<Value>());
+  };
+  job.run(info, async, 0);
+}
+
+/**
+ * @readonly
+ * @kind member
+ * @name layer
+ * @instance
+ * @memberof ArrowStream
+ * @type {Layer}
+ */
+NAN_GETTER(ArrowStream::layerGetter) {
+  info.GetReturnValue().Set(Nan::GetPrivate(info.This(), Nan::New("layer_").ToLocalChecked()).ToLocalChecked());
+}
+
+#endif
+
+} // namespace node_gdal
@@ -0,0 +1,51 @@
+#ifndef __NODE_OGR_ARROW_STREAM_H__
+#define __NODE_OGR_ARROW_STREAM_H__
+
+// node
+#include <node.h>
+#include <node_object_wrap.h>
+
+// nan
+#include "nan-wrapper.h"
+
+// ogr
+#include <ogrsf_frmts.h>
+
+#include "async.hpp"
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+
+using namespace v8;
+using namespace node;
+
+namespace node_gdal {
+
+class ArrowStream : public Nan::ObjectWrap {
+    public:
+  static Nan::Persistent<FunctionTemplate> constructor;
+  static void Initialize(Local<Object> target);
+  static NAN_METHOD(New);
+  static Local<Value> New(
+    std::shared_ptr<ArrowStreamHandle> handle,
+    std::shared_ptr<DatasetResources> resources,
+    Local<Object> layer,
+    long parent_uid);
+  static NAN_METHOD(toString);
+  static NAN_METHOD(close);
+  GDAL_ASYNCABLE_DECLARE(next);
+
+  static NAN_GETTER(layerGetter);
+
+  ArrowStream();
+  void dispose();
+  long parent_uid;
+
+    private:
+  ~ArrowStream();
+  std::shared_ptr<ArrowStreamHandle> handle;
+  std::shared_ptr<DatasetResources> resources;
+};
+
+} // namespace node_gdal
+#endif
+#endif
@@ -1,8 +1,12 @@
+#include <climits>
+#include <memory>
 #include <string>
+#include <vector>
 #include "gdal_coordinate_transformation.hpp"
 #include "gdal_common.hpp"
 #include "gdal_dataset.hpp"
 #include "gdal_spatial_reference.hpp"
+#include "utils/srs_cache.hpp"
 #ifdef BUNDLED_GDAL
 #include "proj.h"
 #endif
@@ -18,8 +22,10 @@ void CoordinateTransformation::Initialize(Local<Object> target) {
   lcons->InstanceTemplate()->SetInternalFieldCount(1);
   lcons->SetClassName(Nan::New("CoordinateTransformation").ToLocalChecked());
 
+  Nan__SetAsyncableMethod(lcons, "create", create);
   Nan::SetPrototypeMethod(lcons, "toString", toString);
   Nan::SetPrototypeMethod(lcons, "transformPoint", transformPoint);
+  Nan__SetPrototypeAsyncableMethod(lcons, "transformArrays", transformArrays);
 
   Nan::Set(target, Nan::New("CoordinateTransformation").ToLocalChecked(), Nan::GetFunction(lcons).ToLocalChecked());
 
@@ -82,7 +88,7 @@ NAN_METHOD(CoordinateTransformation::New) {
       // srs -> srs
       NODE_ARG_WRAPPED(1, "target", SpatialReference, target);
 
-      OGRCoordinateTransformation *transform = OGRCreateCoordinateTransformation(source->get(), target->get());
+      OGRCoordinateTransformation *transform = srs_cache.createTransformation(source->get(), target->get());
       if (!transform) {
         NODE_THROW_LAST_CPLERR;
         return;
@@ -148,6 +154,75 @@ Local<Value> CoordinateTransformation::New(OGRCoordinateTransformation *transfor
   return scope.Escape(obj);
 }
 
+/**
+ * Create a transformation between two spatial references.
+ *
+ * Equivalent to `new CoordinateTransformation(source, target)`
+ * for spatial reference targets.
+ *
+ * @static
+ * @throws {Error}
+ * @method create
+ * @memberof CoordinateTransformation
+ * @param {SpatialReference} source
+ * @param {SpatialReference} target
+ * @return {CoordinateTransformation}
+ */
+
+/**
+ * Create a transformation between two spatial references.
+ * @async
+ *
+ * Creating a transformation involves looking up the PROJ database
+ * and it can take a significant amount of time, this method
+ * does it in a background thread.
+ *
+ * @example
+ *
+ * const ct = await gdal.CoordinateTransformation.createAsync(
+ *   await gdal.SpatialReference.fromEPSGAsync(4326),
+ *   await gdal.SpatialReference.fromEPSGAsync(3857));
+ *
+ * @static
+ * @throws {Error}
+ * @method createAsync
+ * @memberof CoordinateTransformation
+ * @param {SpatialReference} source
+ * @param {SpatialReference} target
+ * @param {callback<CoordinateTransformation>} [callback=undefined]
+ * @return {Promise<CoordinateTransformation>}
+ */
+GDAL_ASYNCABLE_DEFINE(CoordinateTransformation::create) {
+  SpatialReference *source, *target;
+
+  NODE_ARG_WRAPPED(0, "source", SpatialReference, source);
+  NODE_ARG_WRAPPED(1, "target", SpatialReference, target);
+
+  // The background thread works on copies as the SpatialReferences can be modified in the meantime,
+  // they are owned by the job and freed with it, even if it never runs
+  OGRSpatialReference *raw_source = source->get();
+  OGRSpatialReference *raw_target = target->get();
+  std::shared_ptr<OGRSpatialReference> owned_source, owned_target;
+  if (async) {
+    owned_source.reset(raw_source->Clone(), OGRSpatialReference::DestroySpatialReference);
+    owned_target.reset(raw_target->Clone(), OGRSpatialReference::DestroySpatialReference);
+    raw_source = owned_source.get();
+    raw_target = owned_target.get();
+  }
+
+  GDALAsyncableJob<OGRCoordinateTransformation *> job(0);
+  job.main = [raw_source, raw_target, owned_source, owned_target](const GDALExecutionProgress &) {
+    CPLErrorReset();
+    OGRCoordinateTransformation *transform = srs_cache.createTransformation(raw_source, raw_target);
+    if (!transform) throw CPLGetLastErrorMsg();
+    return transform;
+  };
+  job.rval = [](OGRCoordinateTransformation *transform, const GetFromPersistentFunc &) {
+    return CoordinateTransformation::New(transform);
+  };
+  job.run(info, async, 2);
+}
+
 NAN_METHOD(CoordinateTransformation::toString) {
   info.GetReturnValue().Set(Nan::New("CoordinateTransformation").ToLocalChecked());
 }
@@ -227,4 +302,152 @@ NAN_METHOD(CoordinateTransformation::transformPoint) {
   info.GetReturnValue().Set(result);
 }
 
+/**
+ * Transform many points in place from source to destination space
+ * in a single operation.
+ *
+ * The arrays are modified in place, the points that cannot be transformed
+ * have a non-zero value in the returned array of error codes.
+ * With a PROJ-based transformation and GDAL >= 3.3, this is the PROJ error
+ * code of the point.
+ *
+ * @example
+ *
+ * const xs = Float64Array.from([ 20, 21 ]);
+ * const ys = Float64Array.from([ 30, 31 ]);
+ * const errors = transform.transformArrays(xs, ys);
+ *
+ * @method transformArrays
+ * @instance
+ * @memberof CoordinateTransformation
+ * @param {Float64Array} xs
+ * @param {Float64Array} ys
+ * @param {Float64Array} [zs]
+ * @throws {Error}
+ * @return {Int32Array} `0` for the points that were successfully transformed
+ */
+
+/**
+ * Transform many points in place from source to destination space
+ * in a single operation.
+ * @async
+ *
+ * The arrays are modified in place, the points that cannot be transformed
+ * have a non-zero value in the returned array of error codes.
+ * With a PROJ-based transformation and GDAL >= 3.3, this is the PROJ error
+ * code of the point.
+ *
+ * The arrays must not be modified until the operation has completed.
+ * Requires GDAL >= 3.1.
+ *
+ * @method transformArraysAsync
+ * @instance
+ * @memberof CoordinateTransformation
+ * @param {Float64Array} xs
+ * @param {Float64Array} ys
+ * @param {Float64Array} [zs]
+ * @param {callback<Int32Array>} [callback=undefined]
+ * @throws {Error}
+ * @return {Promise<Int32Array>} `0` for the points that were successfully transformed
+ */
+GDAL_ASYNCABLE_DEFINE(CoordinateTransformation::transformArrays) {
+  CoordinateTransformation *transform = Nan::ObjectWrap::Unwrap<CoordinateTransformation>(info.This());
+
+  if (info.Length() < 2) {
+    Nan::ThrowError("Invalid number of arguments");
+    return;
+  }
+  if (!info[0]->IsFloat64Array()) {
+    Nan::ThrowTypeError("xs must be a Float64Array");
+    return;
+  }
+  if (!info[1]->IsFloat64Array()) {
+    Nan::ThrowTypeError("ys must be a Float64Array");
+    return;
+  }
+  bool has_z = info.Length() > 2 && !info[2]->IsUndefined() && !info[2]->IsNull();
+  if (has_z && !info[2]->IsFloat64Array()) {
+    Nan::ThrowTypeError("zs must be a Float64Array");
+    return;
+  }
+
+  Nan::TypedArrayContents<double> xs(info[0]);
+  Nan::TypedArrayContents<double> ys(info[1]);
+  size_t length = xs.length();
+  if (ys.length() != length) {
+    Nan::ThrowRangeError("xs and ys must have the same length");
+    return;
+  }
+  if (length > INT_MAX) {
+    Nan::ThrowRangeError("Too many points");
+    return;
+  }
+  double *x = *xs, *y = *ys, *z = nullptr;
+  std::vector<Local<Object>> arrays = {info[0].As<Object>(), info[1].As<Object>()};
+  if (has_z) {
+    Nan::TypedArrayContents<double> zs(info[2]);
+    if (zs.length() != length) {
+      Nan::ThrowRangeError("zs must have the same length as xs and ys");
+      return;
+    }
+    z = *zs;
+    arrays.push_back(info[2].As<Object>());
+  }
+
+  Local<ArrayBuffer> buffer = ArrayBuffer::New(v8::Isolate::GetCurrent(), length * sizeof(int));
+  Local<Int32Array> errors = Int32Array::New(buffer, 0, length);
+  Nan::TypedArrayContents<int> error_contents(errors);
+  int *error_codes = *error_contents;
+
+  // OGRCoordinateTransformation is not thread-safe, the async version uses its own copy
+  // which is owned by the job and freed with it, even if it never runs
+  OGRCoordinateTransformation *ct = transform->this_;
+  std::shared_ptr<OGRCoordinateTransformation> owned;
+  if (async) {
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 1)
+    owned = std::shared_ptr<OGRCoordinateTransformation>(ct->Clone(), OGRCoordinateTransformation::DestroyCT);
+    if (owned == nullptr) {
+      Nan::ThrowError("Failed cloning the transformation");
+      return;
+    }
+    ct = owned.get();
+#else
+    Nan::ThrowError("transformArraysAsync() requires GDAL >= 3.1");
+    return;
+#endif
+  }
+
+  GDALAsyncableJob<int> job(0);
+  job.persist(arrays);
+  job.persist("errors", errors);
+  job.main = [ct, owned, length, x, y, z, error_codes](const GDALExecutionProgress &) {
+    if (length == 0) return 0;
+    CPLErrorReset();
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 3)
+    int r = ct->TransformWithErrorCodes(length, x, y, z, nullptr, error_codes);
+#else
+    std::vector<int> success(length);
+#if GDAL_VERSION_MAJOR >= 3
+    int r = ct->Transform(length, x, y, z, nullptr, success.data());
+#else
+    int r = ct->TransformEx(length, x, y, z, success.data());
+#endif
+    for (size_t i = 0; i < length; i++) error_codes[i] = success[i] ? 0 : -1;
+#endif
+    // A failure without any error code means that the whole transformation has failed
+    if (!r) {
+      bool any = false;
+      for (size_t i = 0; i < length && !any; i++) any = error_codes[i] != 0;
+      if (!any) {
+        if (CPLGetLastErrorType() == CE_None)
+          CPLError(CE_Failure, CPLE_AppDefined, "Error transforming points");
+        throw CPLGetLastErrorMsg();
+      }
+    }
+    return r;
+  };
+  job.rval = [](int, const GetFromPersistentFunc &getter) { return getter("errors"); };
+  job.run(info, async, 3);
+}
+
 } // namespace node_gdal
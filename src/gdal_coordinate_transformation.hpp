@@ -14,6 +14,8 @@
 // gdal
 #include <gdalwarper.h>
 
+#include "async.hpp"
+
 using namespace v8;
 using namespace node;
 
@@ -28,7 +30,9 @@ class CoordinateTransformation : public Nan::ObjectWrap {
   static NAN_METHOD(New);
   static Local<Value> New(OGRCoordinateTransformation *transform);
   static NAN_METHOD(toString);
+  GDAL_ASYNCABLE_DECLARE(create);
   static NAN_METHOD(transformPoint);
+  GDAL_ASYNCABLE_DECLARE(transformArrays);
 
   CoordinateTransformation();
   CoordinateTransformation(OGRCoordinateTransformation *srs);
@@ -2,6 +2,7 @@
 #include "gdal_group.hpp"
 #include "collections/dataset_bands.hpp"
 #include "collections/dataset_layers.hpp"
+#include "collections/rasterband_pixels.hpp"
 #include "gdal_common.hpp"
 #include "gdal_driver.hpp"
 #include "geometry/gdal_geometry.hpp"
@@ -10,6 +11,7 @@
 #include "gdal_rasterband.hpp"
 #include "gdal_spatial_reference.hpp"
 #include "utils/string_list.hpp"
+#include "utils/typed_array.hpp"
 
 namespace node_gdal {
 
@@ -28,12 +30,16 @@ void Dataset::Initialize(Local<Object> target) {
   Nan::SetPrototypeMethod(lcons, "getGCPProjection", getGCPProjection);
   Nan::SetPrototypeMethod(lcons, "getFileList", getFileList);
   Nan__SetPrototypeAsyncableMethod(lcons, "flush", flush);
+  Nan__SetPrototypeAsyncableMethod(lcons, "startTransaction", startTransaction);
+  Nan__SetPrototypeAsyncableMethod(lcons, "commitTransaction", commitTransaction);
+  Nan__SetPrototypeAsyncableMethod(lcons, "rollbackTransaction", rollbackTransaction);
   Nan::SetPrototypeMethod(lcons, "close", close);
   Nan__SetPrototypeAsyncableMethod(lcons, "getMetadata", getMetadata);
   Nan__SetPrototypeAsyncableMethod(lcons, "setMetadata", setMetadata);
   Nan::SetPrototypeMethod(lcons, "testCapability", testCapability);
   Nan__SetPrototypeAsyncableMethod(lcons, "executeSQL", executeSQL);
   Nan__SetPrototypeAsyncableMethod(lcons, "buildOverviews", buildOverviews);
+  Nan__SetPrototypeAsyncableMethod(lcons, "read", read);
 
   ATTR_DONT_ENUM(lcons, "_uid", uidGetter, READ_ONLY_SETTER);
   ATTR(lcons, "description", descriptionGetter, READ_ONLY_SETTER);
@@ -320,6 +326,8 @@ NAN_METHOD(Dataset::close) {
 /**
  * Flushes all changes to disk.
  *
+ * Throws if blocks returned by `readBlockRef()` are still referenced.
+ *
  * @throws {Error}
  * @method flush
  * @instance
@@ -330,6 +338,8 @@ NAN_METHOD(Dataset::close) {
  * Flushes all changes to disk.
  * @async
  *
+ * Rejects if blocks returned by `readBlockRef()` are still referenced.
+ *
  * @method flushAsync
  * @instance
  * @memberof Dataset
@@ -340,8 +350,16 @@ NAN_METHOD(Dataset::close) {
 GDAL_ASYNCABLE_DEFINE(Dataset::flush) {
   NODE_UNWRAP_CHECK(Dataset, info.This(), ds);
   GDAL_RAW_CHECK(GDALDataset *, ds, raw);
+  std::shared_ptr<DatasetResources> resources;
+  try {
+    resources = object_store.getResources(ds->uid);
+  } catch (const char *msg) {
+    Nan::ThrowError(msg);
+    return;
+  }
   GDALAsyncableJob<int> job(ds->uid);
-  job.main = [raw](const GDALExecutionProgress &) {
+  job.main = [raw, resources](const GDALExecutionProgress &) {
+    object_store.checkNotPinned(resources);
     raw->FlushCache();
     return 0;
   };
@@ -351,6 +369,121 @@ GDAL_ASYNCABLE_DEFINE(Dataset::flush) {
   return;
 }
 
+/**
+ * Starts a transaction on a vector dataset, see
+ * [GDALDataset::StartTransaction](https://gdal.org/api/gdaldataset_cpp.html#_CPPv4N11GDALDataset16StartTransactionEi).
+ *
+ * Inserting many features in a single transaction is much faster
+ * with the database drivers such as GPKG, SQLite or PostgreSQL.
+ *
+ * @throws {Error}
+ * @method startTransaction
+ * @instance
+ * @memberof Dataset
+ * @param {boolean} [force=false] Emulate the transaction if the driver does not support it natively
+ */
+
+/**
+ * Starts a transaction on a vector dataset, see
+ * [GDALDataset::StartTransaction](https://gdal.org/api/gdaldataset_cpp.html#_CPPv4N11GDALDataset16StartTransactionEi).
+ * @async
+ *
+ * Inserting many features in a single transaction is much faster
+ * with the database drivers such as GPKG, SQLite or PostgreSQL.
+ *
+ * @throws {Error}
+ * @method startTransactionAsync
+ * @instance
+ * @memberof Dataset
+ * @param {boolean} [force=false] Emulate the transaction if the driver does not support it natively
+ * @param {callback<void>} [callback=undefined]
+ * @return {Promise<void>}
+ */
+GDAL_ASYNCABLE_DEFINE(Dataset::startTransaction) {
+  NODE_UNWRAP_CHECK(Dataset, info.This(), ds);
+  GDAL_RAW_CHECK(GDALDataset *, ds, raw);
+
+  int force = 0;
+  NODE_ARG_BOOL_OPT(0, "force", force);
+
+  GDALAsyncableJob<OGRErr> job(ds->uid);
+  job.main = [raw, force](const GDALExecutionProgress &) {
+    OGRErr err = raw->StartTransaction(force);
+    if (err) throw getOGRErrMsg(err);
+    return err;
+  };
+  job.rval = [](OGRErr, const GetFromPersistentFunc &) { return Nan::Undefined().As<Value>(); };
+  job.run(info, async, 1);
+}
+
+/**
+ * Commits the current transaction.
+ *
+ * @throws {Error}
+ * @method commitTransaction
+ * @instance
+ * @memberof Dataset
+ */
+
+/**
+ * Commits the current transaction.
+ * @async
+ *
+ * @throws {Error}
+ * @method commitTransactionAsync
+ * @instance
+ * @memberof Dataset
+ * @param {callback<void>} [callback=undefined]
+ * @return {Promise<void>}
+ */
+GDAL_ASYNCABLE_DEFINE(Dataset::commitTransaction) {
+  NODE_UNWRAP_CHECK(Dataset, info.This(), ds);
+  GDAL_RAW_CHECK(GDALDataset *, ds, raw);
+
+  GDALAsyncableJob<OGRErr> job(ds->uid);
+  job.main = [raw](const GDALExecutionProgress &) {
+    OGRErr err = raw->CommitTransaction();
+    if (err) throw getOGRErrMsg(err);
+    return err;
+  };
+  job.rval = [](OGRErr, const GetFromPersistentFunc &) { return Nan::Undefined().As<Value>(); };
+  job.run(info, async, 0);
+}
+
+/**
+ * Rolls back the current transaction.
+ *
+ * @throws {Error}
+ * @method rollbackTransaction
+ * @instance
+ * @memberof Dataset
+ */
+
+/**
+ * Rolls back the current transaction.
+ * @async
+ *
+ * @throws {Error}
+ * @method rollbackTransactionAsync
+ * @instance
+ * @memberof Dataset
+ * @param {callback<void>} [callback=undefined]
+ * @return {Promise<void>}
+ */
+GDAL_ASYNCABLE_DEFINE(Dataset::rollbackTransaction) {
+  NODE_UNWRAP_CHECK(Dataset, info.This(), ds);
+  GDAL_RAW_CHECK(GDALDataset *, ds, raw);
+
+  GDALAsyncableJob<OGRErr> job(ds->uid);
+  job.main = [raw](const GDALExecutionProgress &) {
+    OGRErr err = raw->RollbackTransaction();
+    if (err) throw getOGRErrMsg(err);
+    return err;
+  };
+  job.rval = [](OGRErr, const GetFromPersistentFunc &) { return Nan::Undefined().As<Value>(); };
+  job.run(info, async, 0);
+}
+
 /**
  * Execute an SQL statement against the data store.
  *
@@ -533,6 +666,7 @@ NAN_METHOD(Dataset::setGCPs) {
     Nan::ThrowError("Dataset object has already been destroyed");
     return;
   }
+  GDAL_POOL_CHECK(ds->uid);
 
   GDALDataset *raw = ds->get();
   if (!raw) {
@@ -687,6 +821,211 @@ GDAL_ASYNCABLE_DEFINE(Dataset::buildOverviews) {
   job.run(info, async, 4);
 }
 
+/**
+ * @typedef {object} DatasetReadOptions
+ * @property {number[]} [bands]
+ * @property {string} [interleave]
+ * @property {TypedArray} [data]
+ * @property {string} [data_type]
+ * @property {number} [buffer_width]
+ * @property {number} [buffer_height]
+ * @property {string} [resampling]
+ */
+
+/**
+ * Reads a region of pixels from several bands at once.
+ *
+ * On pixel-interleaved files this decodes each block only once for all bands
+ * instead of once per band.
+ *
+ * @example
+ *
+ * // RGBA tile, pixel-interleaved, 4 bytes per pixel
+ * const rgba = ds.read(0, 0, 256, 256, { bands: [1, 2, 3, 4], interleave: 'pixel' });
+ *
+ * @method read
+ * @instance
+ * @memberof Dataset
+ * @throws {Error}
+ * @param {number} x
+ * @param {number} y
+ * @param {number} width
+ * @param {number} height
+ * @param {DatasetReadOptions} [options]
+ * @param {number[]} [options.bands] Bands to read, all bands by default
+ * @param {string} [options.interleave="band"] `"band"` (all the pixels of the first band, then all the pixels of the second band...) or `"pixel"` (all the bands of the first pixel, then all the bands of the second pixel...)
+ * @param {TypedArray} [options.data] The `TypedArray` to put the data in. A new array is created if not given.
+ * @param {string} [options.data_type] See {@link GDT|GDT constants}, the data type of the first band by default
+ * @param {number} [options.buffer_width=width]
+ * @param {number} [options.buffer_height=height]
+ * @param {string} [options.resampling] Resampling algorithm ({@link GRA|available options})
+ * @return {TypedArray} A `TypedArray` of values.
+ */
+
+/**
+ * Asynchronously reads a region of pixels from several bands at once.
+ * @async
+ *
+ * On pixel-interleaved files this decodes each block only once for all bands
+ * instead of once per band.
+ *
+ * @method readAsync
+ * @instance
+ * @memberof Dataset
+ * @param {number} x
+ * @param {number} y
+ * @param {number} width
+ * @param {number} height
+ * @param {DatasetReadOptions} [options]
+ * @param {number[]} [options.bands] Bands to read, all bands by default
+ * @param {string} [options.interleave="band"] `"band"` (all the pixels of the first band, then all the pixels of the second band...) or `"pixel"` (all the bands of the first pixel, then all the bands of the second pixel...)
+ * @param {TypedArray} [options.data] The `TypedArray` to put the data in. A new array is created if not given.
+ * @param {string} [options.data_type] See {@link GDT|GDT constants}, the data type of the first band by default
+ * @param {number} [options.buffer_width=width]
+ * @param {number} [options.buffer_height=height]
+ * @param {string} [options.resampling] Resampling algorithm ({@link GRA|available options})
+ * @param {callback<TypedArray>} [callback=undefined]
+ * @return {Promise<TypedArray>} A `TypedArray` of values.
+ */
+GDAL_ASYNCABLE_DEFINE(Dataset::read) {
+
+  NODE_UNWRAP_CHECK(Dataset, info.This(), ds);
+  GDAL_RAW_CHECK(GDALDataset *, ds, raw);
+
+  int x, y, w, h;
+  NODE_ARG_INT(0, "x_offset", x);
+  NODE_ARG_INT(1, "y_offset", y);
+  NODE_ARG_INT(2, "x_size", w);
+  NODE_ARG_INT(3, "y_size", h);
+
+  Local<Object> options = Nan::New<Object>();
+  NODE_ARG_OBJECT_OPT(4, "options", options);
+
+  int buffer_w = w, buffer_h = h;
+  NODE_INT_FROM_OBJ_OPT(options, "buffer_width", buffer_w);
+  NODE_INT_FROM_OBJ_OPT(options, "buffer_height", buffer_h);
+
+  Local<Array> bands_array;
+  NODE_ARRAY_FROM_OBJ_OPT(options, "bands", bands_array);
+  std::vector<int> bands;
+  if (!bands_array.IsEmpty()) {
+    for (unsigned i = 0; i < bands_array->Length(); i++) {
+      Local<Value> val = Nan::Get(bands_array, i).ToLocalChecked();
+      if (!val->IsNumber()) {
+        Nan::ThrowError("band array must only contain numbers");
+        return;
+      }
+      bands.push_back(Nan::To<int32_t>(val).ToChecked());
+    }
+  } else {
+    for (int i = 1; i <= raw->GetRasterCount(); i++) bands.push_back(i);
+  }
+  if (bands.empty()) {
+    Nan::ThrowError("Dataset has no raster bands");
+    return;
+  }
+  for (int b : bands) {
+    if (b < 1 || b > raw->GetRasterCount()) {
+      Nan::ThrowRangeError("invalid band id");
+      return;
+    }
+  }
+
+  std::string interleave = "band";
+  NODE_STR_FROM_OBJ_OPT(options, "interleave", interleave);
+  if (interleave != "band" && interleave != "pixel") {
+    Nan::ThrowError("interleave must be \"band\" or \"pixel\"");
+    return;
+  }
+
+  GDALDataType type = raw->GetRasterBand(bands[0])->GetRasterDataType();
+  std::string type_name = "";
+  NODE_STR_FROM_OBJ_OPT(options, "data_type", type_name);
+  if (!type_name.empty()) { type = GDALGetDataTypeByName(type_name.c_str()); }
+
+  GDALRIOResampleAlg resampling;
+  try {
+    resampling = parseResamplingAlg(Nan::Get(options, Nan::New("resampling").ToLocalChecked()).ToLocalChecked());
+  } catch (const char *e) {
+    Nan::ThrowError(e);
+    return;
+  }
+
+  Local<Object> obj;
+  Local<Value> data_val = Nan::Get(options, Nan::New("data").ToLocalChecked()).ToLocalChecked();
+  if (!data_val->IsUndefined() && !data_val->IsNull()) {
+    if (!data_val->IsObject()) {
+      Nan::ThrowTypeError("data must be a TypedArray");
+      return;
+    }
+    obj = data_val.As<Object>();
+    type = TypedArray::Identify(obj);
+    if (type == GDT_Unknown) {
+      Nan::ThrowError("Invalid array");
+      return;
+    }
+  }
+
+  int n_bands = bands.size();
+  int bytes_per_pixel = GDALGetDataTypeSize(type) / 8;
+  GSpacing pixel_space, line_space, band_space;
+  if (interleave == "pixel") {
+    pixel_space = (GSpacing)bytes_per_pixel * n_bands;
+    line_space = pixel_space * buffer_w;
+    band_space = bytes_per_pixel;
+  } else {
+    pixel_space = bytes_per_pixel;
+    line_space = pixel_space * buffer_w;
+    band_space = line_space * buffer_h;
+  }
+  int64_t length = (int64_t)buffer_w * buffer_h * n_bands;
+
+  if (obj.IsEmpty()) {
+    Local<Value> array = TypedArray::New(type, length);
+    if (array.IsEmpty() || !array->IsObject()) {
+      return; // TypedArray::New threw an error
+    }
+    obj = array.As<Object>();
+  }
+
+  void *data = TypedArray::Validate(obj, type, length);
+  if (!data) {
+    return; // TypedArray::Validate threw an error
+  }
+
+  GDALAsyncableJob<CPLErr> job(ds->uid);
+  job.persist("array", obj);
+  job.readOnly = true;
+  job.main = [raw, x, y, w, h, data, buffer_w, buffer_h, type, bands, pixel_space, line_space, band_space, resampling](
+               const GDALExecutionProgress &) {
+    GDALRasterIOExtraArg extra;
+    INIT_RASTERIO_EXTRA_ARG(extra);
+    extra.eResampleAlg = resampling;
+
+    CPLErrorReset();
+    CPLErr err = readerDataset(raw)->RasterIO(
+      GF_Read,
+      x,
+      y,
+      w,
+      h,
+      data,
+      buffer_w,
+      buffer_h,
+      type,
+      bands.size(),
+      const_cast<int *>(bands.data()),
+      pixel_space,
+      line_space,
+      band_space,
+      &extra);
+    if (err != CE_None) throw CPLGetLastErrorMsg();
+    return err;
+  };
+  job.rval = [](CPLErr, const GetFromPersistentFunc &getter) { return getter("array"); };
+  job.run(info, async, 5);
+}
+
 /**
  * @readonly
  * @kind member
@@ -749,18 +1088,20 @@ GDAL_ASYNCABLE_GETTER_DEFINE(Dataset::rasterSizeGetter) {
   GDALDataset *raw = ds->get();
 
   GDALAsyncableJob<xy> job(ds->uid);
+  job.readOnly = true;
 
   job.main = [raw](const GDALExecutionProgress &) {
+    GDALDataset *reader = readerDataset(raw);
     xy result;
     // GDAL 2.x will return 512x512 for vector datasets... which doesn't really make
     // sense in JS where we can return null instead of a number
     // https://github.com/OSGeo/gdal/blob/beef45c130cc2778dcc56d85aed1104a9b31f7e6/gdal/gcore/gdaldataset.cpp#L173-L174
-    if (raw->GetDriver() == nullptr || !raw->GetDriver()->GetMetadataItem(GDAL_DCAP_RASTER)) {
+    if (reader->GetDriver() == nullptr || !reader->GetDriver()->GetMetadataItem(GDAL_DCAP_RASTER)) {
       result.null = true;
       return result;
     }
-    result.x = raw->GetRasterXSize();
-    result.y = raw->GetRasterYSize();
+    result.x = reader->GetRasterXSize();
+    result.y = reader->GetRasterYSize();
     result.null = false;
     return result;
   };
@@ -811,10 +1152,11 @@ GDAL_ASYNCABLE_GETTER_DEFINE(Dataset::srsGetter) {
   GDALDataset *raw = ds->get();
 
   GDALAsyncableJob<OGRSpatialReference *> job(ds->uid);
+  job.readOnly = true;
 
   job.main = [raw](const GDALExecutionProgress &) {
     // get projection wkt and return null if not set
-    OGRChar *wkt = (OGRChar *)raw->GetProjectionRef();
+    OGRChar *wkt = (OGRChar *)readerDataset(raw)->GetProjectionRef();
     if (*wkt == '\0') {
       // getProjectionRef returns string of length 0 if no srs set
       return (OGRSpatialReference *)nullptr;
@@ -881,10 +1223,11 @@ GDAL_ASYNCABLE_GETTER_DEFINE(Dataset::geoTransformGetter) {
   GDALDataset *raw = ds->get();
 
   GDALAsyncableJob<std::shared_ptr<double>> job(ds->uid);
+  job.readOnly = true;
 
   job.main = [raw](const GDALExecutionProgress &) {
     auto transform = std::shared_ptr<double>(new double[6], array_deleter<double>());
-    CPLErr err = raw->GetGeoTransform(transform.get());
+    CPLErr err = readerDataset(raw)->GetGeoTransform(transform.get());
     // This is mostly (always?) a sign that it has not been set
     if (err) { return std::shared_ptr<double>(nullptr); }
     return transform;
@@ -933,6 +1276,7 @@ NAN_SETTER(Dataset::srsSetter) {
     Nan::ThrowError("Dataset object has already been destroyed");
     return;
   }
+  GDAL_POOL_CHECK(ds->uid);
 
   GDALDataset *raw = ds->get();
   std::string wkt("");
@@ -967,6 +1311,7 @@ NAN_SETTER(Dataset::geoTransformSetter) {
     Nan::ThrowError("Dataset object has already been destroyed");
     return;
   }
+  GDAL_POOL_CHECK(ds->uid);
 
   GDALDataset *raw = ds->get();
 
@@ -33,6 +33,9 @@ class Dataset : public Nan::ObjectWrap {
   static Local<Value> New(GDALDataset *ds, GDALDataset *parent = nullptr);
   static NAN_METHOD(toString);
   GDAL_ASYNCABLE_DECLARE(flush);
+  GDAL_ASYNCABLE_DECLARE(startTransaction);
+  GDAL_ASYNCABLE_DECLARE(commitTransaction);
+  GDAL_ASYNCABLE_DECLARE(rollbackTransaction);
   GDAL_ASYNCABLE_DECLARE(getMetadata);
   GDAL_ASYNCABLE_DECLARE(setMetadata);
   static NAN_METHOD(getFileList);
@@ -42,6 +45,7 @@ class Dataset : public Nan::ObjectWrap {
   GDAL_ASYNCABLE_DECLARE(executeSQL);
   static NAN_METHOD(testCapability);
   GDAL_ASYNCABLE_DECLARE(buildOverviews);
+  GDAL_ASYNCABLE_DECLARE(read);
   static NAN_METHOD(close);
 
   static NAN_GETTER(bandsGetter);
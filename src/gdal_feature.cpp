@@ -63,6 +63,16 @@ void Feature::dispose() {
   }
 }
 
+// Replace the underlying OGRFeature, used by the cursors that reuse a single wrapper
+// Nothing handed out to JS points inside the old feature: getGeometry() returns a copy
+// and the fields are always read through this wrapper
+void Feature::reset(OGRFeature *feature) {
+  LOG("Resetting Feature [%p] to [%p]", this_, feature);
+  if (this_ && owned_) OGRFeature::DestroyFeature(this_);
+  this_ = feature;
+  owned_ = true;
+}
+
 /**
  * A simple feature, including geometry and attributes. Its fields and geometry
  * type is defined by the given definition.
@@ -49,6 +49,7 @@ class Feature : public Nan::ObjectWrap {
     return this_;
   }
   void dispose();
+  void reset(OGRFeature *feature);
 
     private:
   ~Feature();
@@ -2,6 +2,7 @@
 #include "gdal_layer.hpp"
 #include "collections/layer_features.hpp"
 #include "collections/layer_fields.hpp"
+#include "gdal_arrow_stream.hpp"
 #include "gdal_common.hpp"
 #include "gdal_dataset.hpp"
 #include "gdal_feature.hpp"
@@ -9,6 +10,7 @@
 #include "gdal_field_defn.hpp"
 #include "geometry/gdal_geometry.hpp"
 #include "gdal_spatial_reference.hpp"
+#include "utils/string_list.hpp"
 
 #include <sstream>
 #include <stdlib.h>
@@ -25,12 +27,16 @@ void Layer::Initialize(Local<Object> target) {
   lcons->SetClassName(Nan::New("Layer").ToLocalChecked());
 
   Nan::SetPrototypeMethod(lcons, "toString", toString);
-  Nan::SetPrototypeMethod(lcons, "getExtent", getExtent);
-  Nan::SetPrototypeMethod(lcons, "setAttributeFilter", setAttributeFilter);
-  Nan::SetPrototypeMethod(lcons, "setSpatialFilter", setSpatialFilter);
+  Nan__SetPrototypeAsyncableMethod(lcons, "getExtent", getExtent);
+  Nan__SetPrototypeAsyncableMethod(lcons, "setAttributeFilter", setAttributeFilter);
+  Nan__SetPrototypeAsyncableMethod(lcons, "setSpatialFilter", setSpatialFilter);
   Nan::SetPrototypeMethod(lcons, "getSpatialFilter", getSpatialFilter);
+  Nan::SetPrototypeMethod(lcons, "setIgnoredFields", setIgnoredFields);
+  Nan::SetPrototypeMethod(lcons, "selectFields", selectFields);
   Nan::SetPrototypeMethod(lcons, "testCapability", testCapability);
   Nan__SetPrototypeAsyncableMethod(lcons, "flush", syncToDisk);
+  Nan__SetPrototypeAsyncableMethod(lcons, "getArrowStream", getArrowStream);
+  Nan__SetPrototypeAsyncableMethod(lcons, "writeBatch", writeBatch);
 
   ATTR_DONT_ENUM(lcons, "ds", dsGetter, READ_ONLY_SETTER);
   ATTR_DONT_ENUM(lcons, "_uid", uidGetter, READ_ONLY_SETTER);
@@ -182,6 +188,436 @@ NAN_METHOD(Layer::toString) {
  */
 NODE_WRAPPED_ASYNC_METHOD_WITH_OGRERR_RESULT_LOCKED(Layer, syncToDisk, SyncToDisk);
 
+/**
+ * Returns a stream of Arrow record batches with the features of the layer,
+ * see {@link ArrowStream}.
+ *
+ * This is much faster than retrieving the features one by one when reading
+ * large layers. Requires GDAL >= 3.6.
+ *
+ * The layer should not be read by other means while the stream is in use.
+ *
+ * @example
+ *
+ * const stream = layer.getArrowStream({ INCLUDE_FID: 'NO' });
+ * let batch;
+ * while ((batch = stream.next()) !== null) {
+ *   const wkb = batch.columns[layer.geomColumn || 'wkb_geometry'];
+ *   ...
+ * }
+ *
+ * @throws {Error}
+ * @method getArrowStream
+ * @instance
+ * @memberof Layer
+ * @param {StringOptions} [options] [Options of OGRLayer::GetArrowStream](https://gdal.org/api/ogrlayer_cpp.html#_CPPv4N8OGRLayer14GetArrowStreamEP16ArrowArrayStream12CSLConstList) such as `MAX_FEATURES_IN_BATCH`, `INCLUDE_FID` or `GEOMETRY_ENCODING`
+ * @return {ArrowStream}
+ */
+
+/**
+ * Returns a stream of Arrow record batches with the features of the layer,
+ * see {@link ArrowStream}.
+ * @async
+ *
+ * This is much faster than retrieving the features one by one when reading
+ * large layers. Requires GDAL >= 3.6.
+ *
+ * The layer should not be read by other means while the stream is in use.
+ *
+ * @example
+ *
+ * const stream = await layer.getArrowStreamAsync({ MAX_FEATURES_IN_BATCH: 10000 });
+ * for await (const batch of stream) {
+ *   ...
+ * }
+ *
+ * @throws {Error}
+ * @method getArrowStreamAsync
+ * @instance
+ * @memberof Layer
+ * @param {StringOptions} [options] [Options of OGRLayer::GetArrowStream](https://gdal.org/api/ogrlayer_cpp.html#_CPPv4N8OGRLayer14GetArrowStreamEP16ArrowArrayStream12CSLConstList) such as `MAX_FEATURES_IN_BATCH`, `INCLUDE_FID` or `GEOMETRY_ENCODING`
+ * @param {callback<ArrowStream>} [callback=undefined]
+ * @return {Promise<ArrowStream>}
+ */
+GDAL_ASYNCABLE_DEFINE(Layer::getArrowStream) {
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(info.This());
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object has already been destroyed");
+    return;
+  }
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+  auto options = std::make_shared<StringList>();
+  if (info.Length() > 0 && options->parse(info[0])) {
+    return; // error parsing string list
+  }
+
+  std::shared_ptr<DatasetResources> resources;
+  try {
+    resources = object_store.getResources(layer->parent_uid);
+  } catch (const char *msg) {
+    Nan::ThrowError(msg);
+    return;
+  }
+
+  OGRLayer *gdal_layer = layer->get();
+  long parent_uid = layer->parent_uid;
+  GDALAsyncableJob<std::shared_ptr<ArrowStreamHandle>> job(parent_uid);
+  job.persist("layer", info.This());
+  job.main = [gdal_layer, options, resources](const GDALExecutionProgress &) {
+    auto handle = std::make_shared<ArrowStreamHandle>();
+    CPLErrorReset();
+    if (!gdal_layer->GetArrowStream(&handle->stream, options->get())) { throw CPLGetLastErrorMsg(); }
+
+    struct ArrowSchema schema;
+    if (handle->stream.get_schema(&handle->stream, &schema) != 0) {
+      const char *msg = handle->stream.get_last_error(&handle->stream);
+      CPLError(CE_Failure, CPLE_AppDefined, "%s", msg ? msg : "Failed retrieving the Arrow schema");
+      handle->release();
+      throw CPLGetLastErrorMsg();
+    }
+    for (int64_t i = 0; i < schema.n_children; i++) {
+      const struct ArrowSchema *child = schema.children[i];
+      handle->columns.push_back(
+        {child->name ? child->name : "", child->format ? child->format : "", child->dictionary != nullptr});
+    }
+    schema.release(&schema);
+
+    object_store.addArrowStream(resources, handle);
+    return handle;
+  };
+  job.rval = [resources, parent_uid](std::shared_ptr<ArrowStreamHandle> handle, const GetFromPersistentFunc &getter) {
+    return ArrowStream::New(handle, resources, getter("layer").As<Object>(), parent_uid);
+  };
+  job.run(info, async, 1);
+#else
+  Nan::ThrowError("Arrow streams require GDAL >= 3.6");
+#endif
+}
+
+// A column of a Layer.writeBatch(), TypedArrays are accessed in place
+// while plain Arrays are converted on the main thread
+struct BatchValue {
+  char kind; // n(ull), i(nteger), d(ouble) or s(tring)
+  double number;
+  std::string string;
+};
+
+struct BatchColumn {
+  std::string name;
+  char type; // the Arrow format character of the TypedArray or 'a' for an Array
+  const void *data;
+  std::vector<BatchValue> values;
+};
+
+template <typename T> static inline T batchAt(const BatchColumn &col, size_t i) {
+  return static_cast<const T *>(col.data)[i];
+}
+
+static inline void setBatchField(OGRFeature *f, int field, const BatchColumn &col, size_t i) {
+  switch (col.type) {
+    case 'c': f->SetField(field, static_cast<int>(batchAt<int8_t>(col, i))); break;
+    case 'C': f->SetField(field, static_cast<int>(batchAt<uint8_t>(col, i))); break;
+    case 's': f->SetField(field, static_cast<int>(batchAt<int16_t>(col, i))); break;
+    case 'S': f->SetField(field, static_cast<int>(batchAt<uint16_t>(col, i))); break;
+    case 'i': f->SetField(field, static_cast<int>(batchAt<int32_t>(col, i))); break;
+    case 'I': f->SetField(field, static_cast<GIntBig>(batchAt<uint32_t>(col, i))); break;
+    case 'l': f->SetField(field, static_cast<GIntBig>(batchAt<int64_t>(col, i))); break;
+    case 'L': f->SetField(field, static_cast<GIntBig>(batchAt<uint64_t>(col, i))); break;
+    case 'f': f->SetField(field, static_cast<double>(batchAt<float>(col, i))); break;
+    case 'g': f->SetField(field, batchAt<double>(col, i)); break;
+    case 'a': {
+      const BatchValue &v = col.values[i];
+      switch (v.kind) {
+        case 'i': f->SetField(field, static_cast<int>(v.number)); break;
+        case 'd': f->SetField(field, v.number); break;
+        case 's': f->SetField(field, v.string.c_str()); break;
+        default: f->UnsetField(field); break;
+      }
+      break;
+    }
+  }
+}
+
+/**
+ * @typedef {object} FeatureBatch
+ * @property {Record<string, Int8Array|Uint8Array|Int16Array|Uint16Array|Int32Array|Uint32Array|BigInt64Array|BigUint64Array|Float32Array|Float64Array|(string|number|null)[]>} [columns] Values of the fields, plain arrays can contain `null` values and the strings are converted to the field type by GDAL
+ * @property {Uint8Array} [geometryWKB] The WKB geometries of all the features, one after another
+ * @property {Int32Array|BigInt64Array} [offsets] Required with `geometryWKB`, the geometry of feature `i` is `geometryWKB[offsets[i]...offsets[i+1]]`, an empty range means no geometry
+ */
+
+/**
+ * Creates many features at once from columnar data.
+ *
+ * The features are built and written in one operation without creating
+ * any JS object for them, this is much faster than adding them one by one
+ * with {@link LayerFeatures.add} when loading large layers.
+ * All columns must have the same length, the data is written in a transaction
+ * if the driver supports it and nothing is written if a feature fails.
+ *
+ * The TypedArrays are accessed in place and they must not be modified
+ * while the operation is running.
+ *
+ * @example
+ *
+ * layer.writeBatch({
+ *   columns: {
+ *     id: new Int32Array([ 1, 2 ]),
+ *     name: [ 'first', null ]
+ *   },
+ *   geometryWKB: wkb,
+ *   offsets: new Int32Array([ 0, 21, 42 ])
+ * });
+ *
+ * @throws {Error}
+ * @method writeBatch
+ * @instance
+ * @memberof Layer
+ * @param {FeatureBatch} batch
+ * @return {number} Number of features created
+ */
+
+/**
+ * Creates many features at once from columnar data.
+ * @async
+ *
+ * The features are built and written in one operation without creating
+ * any JS object for them, this is much faster than adding them one by one
+ * with {@link LayerFeatures.addAsync} when loading large layers.
+ * All columns must have the same length, the data is written in a transaction
+ * if the driver supports it and nothing is written if a feature fails.
+ *
+ * The TypedArrays are accessed in place and they must not be modified
+ * while the operation is running.
+ *
+ * @throws {Error}
+ * @method writeBatchAsync
+ * @instance
+ * @memberof Layer
+ * @param {FeatureBatch} batch
+ * @param {callback<number>} [callback=undefined]
+ * @return {Promise<number>} Number of features created
+ */
+GDAL_ASYNCABLE_DEFINE(Layer::writeBatch) {
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(info.This());
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object has already been destroyed");
+    return;
+  }
+
+  Local<Object> batch;
+  NODE_ARG_OBJECT(0, "batch", batch);
+
+  std::vector<Local<Object>> arrays;
+  auto columns = std::make_shared<std::vector<BatchColumn>>();
+  int64_t length = -1;
+
+  Local<Value> columns_val = Nan::Get(batch, Nan::New("columns").ToLocalChecked()).ToLocalChecked();
+  if (!columns_val->IsUndefined() && !columns_val->IsNull()) {
+    if (!columns_val->IsObject()) {
+      Nan::ThrowTypeError("columns must be an object");
+      return;
+    }
+    Local<Object> columns_obj = columns_val.As<Object>();
+    Local<Array> names = Nan::GetOwnPropertyNames(columns_obj).ToLocalChecked();
+    for (uint32_t i = 0; i < names->Length(); i++) {
+      Local<Value> name = Nan::Get(names, i).ToLocalChecked();
+      Local<Value> val = Nan::Get(columns_obj, name).ToLocalChecked();
+      BatchColumn col;
+      col.name = *Nan::Utf8String(name);
+      col.data = nullptr;
+      int64_t col_length;
+
+      if (val->IsArray()) {
+        Local<Array> array = val.As<Array>();
+        col.type = 'a';
+        col_length = array->Length();
+        col.values.resize(col_length);
+        for (uint32_t j = 0; j < array->Length(); j++) {
+          Local<Value> el = Nan::Get(array, j).ToLocalChecked();
+          BatchValue &v = col.values[j];
+          if (el->IsInt32()) {
+            v.kind = 'i';
+            v.number = Nan::To<int32_t>(el).ToChecked();
+          } else if (el->IsNumber()) {
+            v.kind = 'd';
+            v.number = Nan::To<double>(el).ToChecked();
+          } else if (el->IsString()) {
+            v.kind = 's';
+            v.string = *Nan::Utf8String(el);
+          } else if (el->IsNull() || el->IsUndefined()) {
+            v.kind = 'n';
+          } else {
+            Nan::ThrowTypeError(("Unsupported value in column " + col.name).c_str());
+            return;
+          }
+        }
+      } else if (val->IsTypedArray()) {
+        if (val->IsInt8Array()) {
+          Nan::TypedArrayContents<int8_t> contents(val);
+          col.type = 'c';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsUint8Array() || val->IsUint8ClampedArray()) {
+          Nan::TypedArrayContents<uint8_t> contents(val);
+          col.type = 'C';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsInt16Array()) {
+          Nan::TypedArrayContents<int16_t> contents(val);
+          col.type = 's';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsUint16Array()) {
+          Nan::TypedArrayContents<uint16_t> contents(val);
+          col.type = 'S';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsInt32Array()) {
+          Nan::TypedArrayContents<int32_t> contents(val);
+          col.type = 'i';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsUint32Array()) {
+          Nan::TypedArrayContents<uint32_t> contents(val);
+          col.type = 'I';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsBigInt64Array()) {
+          Nan::TypedArrayContents<int64_t> contents(val);
+          col.type = 'l';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsBigUint64Array()) {
+          Nan::TypedArrayContents<uint64_t> contents(val);
+          col.type = 'L';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsFloat32Array()) {
+          Nan::TypedArrayContents<float> contents(val);
+          col.type = 'f';
+          col.data = *contents;
+          col_length = contents.length();
+        } else if (val->IsFloat64Array()) {
+          Nan::TypedArrayContents<double> contents(val);
+          col.type = 'g';
+          col.data = *contents;
+          col_length = contents.length();
+        } else {
+          Nan::ThrowTypeError(("Unsupported array type in column " + col.name).c_str());
+          return;
+        }
+        arrays.push_back(val.As<Object>());
+      } else {
+        Nan::ThrowTypeError(("Column " + col.name + " must be an Array or a TypedArray").c_str());
+        return;
+      }
+
+      if (length >= 0 && col_length != length) {
+        Nan::ThrowRangeError("All columns must have the same length");
+        return;
+      }
+      length = col_length;
+      columns->push_back(std::move(col));
+    }
+  }
+
+  const uint8_t *wkb = nullptr;
+  std::shared_ptr<std::vector<int64_t>> offsets;
+  Local<Value> wkb_val = Nan::Get(batch, Nan::New("geometryWKB").ToLocalChecked()).ToLocalChecked();
+  if (!wkb_val->IsUndefined() && !wkb_val->IsNull()) {
+    if (!wkb_val->IsUint8Array()) {
+      Nan::ThrowTypeError("geometryWKB must be an Uint8Array");
+      return;
+    }
+    Nan::TypedArrayContents<uint8_t> wkb_contents(wkb_val);
+    wkb = *wkb_contents;
+    int64_t wkb_length = wkb_contents.length();
+    arrays.push_back(wkb_val.As<Object>());
+
+    Local<Value> offsets_val = Nan::Get(batch, Nan::New("offsets").ToLocalChecked()).ToLocalChecked();
+    offsets = std::make_shared<std::vector<int64_t>>();
+    if (offsets_val->IsInt32Array()) {
+      Nan::TypedArrayContents<int32_t> contents(offsets_val);
+      offsets->assign(*contents, *contents + contents.length());
+    } else if (offsets_val->IsBigInt64Array()) {
+      Nan::TypedArrayContents<int64_t> contents(offsets_val);
+      offsets->assign(*contents, *contents + contents.length());
+    } else {
+      Nan::ThrowTypeError("offsets must be an Int32Array or a BigInt64Array");
+      return;
+    }
+
+    if (offsets->size() < 1 || (length >= 0 && static_cast<int64_t>(offsets->size()) != length + 1)) {
+      Nan::ThrowRangeError("offsets must have one more element than the columns");
+      return;
+    }
+    for (size_t i = 0; i < offsets->size(); i++) {
+      if ((*offsets)[i] < 0 || (*offsets)[i] > wkb_length || (i > 0 && (*offsets)[i] < (*offsets)[i - 1])) {
+        Nan::ThrowRangeError("Invalid geometry offsets");
+        return;
+      }
+    }
+    length = offsets->size() - 1;
+  }
+  if (length < 0) length = 0;
+
+  OGRLayer *gdal_layer = layer->get();
+  GDALDataset *gdal_ds = layer->getParent();
+  GDALAsyncableJob<int64_t> job(layer->parent_uid);
+  job.persist(arrays);
+  job.main = [gdal_layer, gdal_ds, columns, wkb, offsets, length](const GDALExecutionProgress &) {
+    OGRFeatureDefn *defn = gdal_layer->GetLayerDefn();
+    std::vector<int> fields;
+    for (const BatchColumn &col : *columns) {
+      int idx = defn->GetFieldIndex(col.name.c_str());
+      if (idx < 0) {
+        CPLError(CE_Failure, CPLE_AppDefined, "Field '%s' does not exist", col.name.c_str());
+        throw CPLGetLastErrorMsg();
+      }
+      fields.push_back(idx);
+    }
+    OGRSpatialReference *srs = gdal_layer->GetSpatialRef();
+
+    bool transaction = gdal_ds && gdal_ds->StartTransaction(FALSE) == OGRERR_NONE;
+    CPLErrorReset();
+
+    OGRFeature *f = new OGRFeature(defn);
+    for (int64_t i = 0; i < length; i++) {
+      for (size_t c = 0; c < columns->size(); c++) setBatchField(f, fields[c], (*columns)[c], i);
+
+      OGRGeometry *geom = nullptr;
+      if (offsets && (*offsets)[i + 1] > (*offsets)[i]) {
+        OGRErr err = OGRGeometryFactory::createFromWkb(
+          wkb + (*offsets)[i], srs, &geom, static_cast<size_t>((*offsets)[i + 1] - (*offsets)[i]));
+        if (err != OGRERR_NONE) {
+          delete f;
+          if (transaction) gdal_ds->RollbackTransaction();
+          throw getOGRErrMsg(err);
+        }
+      }
+      f->SetGeometryDirectly(geom);
+      f->SetFID(OGRNullFID);
+
+      OGRErr err = gdal_layer->CreateFeature(f);
+      if (err != OGRERR_NONE) {
+        delete f;
+        if (transaction) gdal_ds->RollbackTransaction();
+        throw getOGRErrMsg(err);
+      }
+    }
+    delete f;
+
+    if (transaction) {
+      OGRErr err = gdal_ds->CommitTransaction();
+      if (err != OGRERR_NONE) throw getOGRErrMsg(err);
+    }
+    return length;
+  };
+  job.rval = [](int64_t count, const GetFromPersistentFunc &) { return Nan::New<Number>(static_cast<double>(count)); };
+  job.run(info, async, 1);
+}
+
 /**
  * Determines if the dataset supports the indicated operation.
  *
@@ -193,6 +629,12 @@ NODE_WRAPPED_ASYNC_METHOD_WITH_OGRERR_RESULT_LOCKED(Layer, syncToDisk, SyncToDis
  */
 NODE_WRAPPED_METHOD_WITH_RESULT_1_STRING_PARAM_LOCKED(Layer, testCapability, Boolean, TestCapability, "capability");
 
+/**
+ * @typedef {object} ExtentOptions
+ * @property {boolean} [force]
+ * @property {number|string} [geomField]
+ */
+
 /**
  * Fetch the extent of this layer.
  *
@@ -200,10 +642,34 @@ NODE_WRAPPED_METHOD_WITH_RESULT_1_STRING_PARAM_LOCKED(Layer, testCapability, Boo
  * @method getExtent
  * @instance
  * @memberof Layer
- * @param {boolean} [force=true]
+ * @param {boolean|ExtentOptions} [force=true] Compute the extent even if it is expensive, can also be an options object
+ * @param {boolean} [force.force=true] Compute the extent even if it is expensive
+ * @param {number|string} [force.geomField=0] Index or name of the geometry field
  * @return {Envelope} Bounding envelope
  */
-NAN_METHOD(Layer::getExtent) {
+
+/**
+ * Fetch the extent of this layer.
+ * @async
+ *
+ * Computing the extent can require reading the whole layer,
+ * this version does not block the event loop.
+ *
+ * @example
+ *
+ * const extent = await layer.getExtentAsync({ force: true, geomField: 'geom' });
+ *
+ * @throws {Error}
+ * @method getExtentAsync
+ * @instance
+ * @memberof Layer
+ * @param {boolean|ExtentOptions} [force=true] Compute the extent even if it is expensive, can also be an options object
+ * @param {boolean} [force.force=true] Compute the extent even if it is expensive
+ * @param {number|string} [force.geomField=0] Index or name of the geometry field
+ * @param {callback<Envelope>} [callback=undefined]
+ * @return {Promise<Envelope>} Bounding envelope
+ */
+GDAL_ASYNCABLE_DEFINE(Layer::getExtent) {
 
   Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(info.This());
   if (!layer->isAlive()) {
@@ -212,24 +678,59 @@ NAN_METHOD(Layer::getExtent) {
   }
 
   int force = 1;
-  NODE_ARG_BOOL_OPT(0, "force", force);
-
-  std::unique_ptr<OGREnvelope> envelope(new OGREnvelope());
-  GDAL_LOCK_PARENT(layer);
-  OGRErr err = layer->this_->GetExtent(envelope.get(), force);
-
-  if (err) {
-    Nan::ThrowError("Can't get layer extent without computing it");
-    return;
+  // -1 is the default geometry field
+  int geom_field = -1;
+  std::string geom_field_name;
+  if (info.Length() > 0 && info[0]->IsObject() && !info[0]->IsNull()) {
+    Local<Object> options = info[0].As<Object>();
+    Local<Value> force_val = Nan::Get(options, Nan::New("force").ToLocalChecked()).ToLocalChecked();
+    if (!force_val->IsUndefined()) force = Nan::To<bool>(force_val).ToChecked();
+    Local<Value> field_val = Nan::Get(options, Nan::New("geomField").ToLocalChecked()).ToLocalChecked();
+    if (field_val->IsString()) {
+      geom_field_name = *Nan::Utf8String(field_val);
+    } else if (field_val->IsNumber()) {
+      geom_field = Nan::To<int32_t>(field_val).ToChecked();
+      if (geom_field < 0) {
+        Nan::ThrowRangeError("geomField must be a positive integer");
+        return;
+      }
+    } else if (!field_val->IsUndefined() && !field_val->IsNull()) {
+      Nan::ThrowTypeError("geomField must be a number or a string");
+      return;
+    }
+  } else {
+    NODE_ARG_BOOL_OPT(0, "force", force);
   }
 
-  Local<Object> obj = Nan::New<Object>();
-  Nan::Set(obj, Nan::New("minX").ToLocalChecked(), Nan::New<Number>(envelope->MinX));
-  Nan::Set(obj, Nan::New("maxX").ToLocalChecked(), Nan::New<Number>(envelope->MaxX));
-  Nan::Set(obj, Nan::New("minY").ToLocalChecked(), Nan::New<Number>(envelope->MinY));
-  Nan::Set(obj, Nan::New("maxY").ToLocalChecked(), Nan::New<Number>(envelope->MaxY));
-
-  info.GetReturnValue().Set(obj);
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<OGREnvelope> job(layer->parent_uid);
+  job.main = [gdal_layer, force, geom_field, geom_field_name](const GDALExecutionProgress &) {
+    int field = geom_field;
+    if (!geom_field_name.empty()) {
+      field = gdal_layer->GetLayerDefn()->GetGeomFieldIndex(geom_field_name.c_str());
+      if (field < 0) {
+        CPLError(CE_Failure, CPLE_AppDefined, "Geometry field '%s' does not exist", geom_field_name.c_str());
+        throw CPLGetLastErrorMsg();
+      }
+    } else if (field >= gdal_layer->GetLayerDefn()->GetGeomFieldCount()) {
+      CPLError(CE_Failure, CPLE_AppDefined, "Geometry field %d does not exist", field);
+      throw CPLGetLastErrorMsg();
+    }
+    OGREnvelope envelope;
+    OGRErr err = field <= 0 ? gdal_layer->GetExtent(&envelope, force) : gdal_layer->GetExtent(field, &envelope, force);
+    if (err) throw "Can't get layer extent without computing it";
+    return envelope;
+  };
+  job.rval = [](OGREnvelope envelope, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    Local<Object> obj = Nan::New<Object>();
+    Nan::Set(obj, Nan::New("minX").ToLocalChecked(), Nan::New<Number>(envelope.MinX));
+    Nan::Set(obj, Nan::New("maxX").ToLocalChecked(), Nan::New<Number>(envelope.MaxX));
+    Nan::Set(obj, Nan::New("minY").ToLocalChecked(), Nan::New<Number>(envelope.MinY));
+    Nan::Set(obj, Nan::New("maxY").ToLocalChecked(), Nan::New<Number>(envelope.MaxY));
+    return scope.Escape(obj);
+  };
+  job.run(info, async, 1);
 }
 
 /**
@@ -293,7 +794,52 @@ NAN_METHOD(Layer::getSpatialFilter) {
  * @param {number} maxX
  * @param {number} maxY
  */
-NAN_METHOD(Layer::setSpatialFilter) {
+
+/**
+ * This method sets the geometry to be used as a spatial filter when fetching
+ * features via the `layer.features.next()` method. Only features that
+ * geometrically intersect the filter geometry will be returned.
+ * @async
+ *
+ * Alernatively you can pass it envelope bounds as individual arguments.
+ *
+ * @example
+ *
+ * await layer.setSpatialFilterAsync(geometry);
+ *
+ * @throws {Error}
+ * @method setSpatialFilterAsync
+ * @instance
+ * @memberof Layer
+ * @param {Geometry|null} filter
+ * @param {callback<void>} [callback=undefined]
+ * @return {Promise<void>}
+ */
+
+/**
+ * This method sets the geometry to be used as a spatial filter when fetching
+ * features via the `layer.features.next()` method. Only features that
+ * geometrically intersect the filter geometry will be returned.
+ * @async
+ *
+ * Alernatively you can pass it envelope bounds as individual arguments.
+ *
+ * @example
+ *
+ * await layer.setSpatialFilterAsync(minX, minY, maxX, maxY);
+ *
+ * @throws {Error}
+ * @method setSpatialFilterAsync
+ * @instance
+ * @memberof Layer
+ * @param {number} minxX
+ * @param {number} minyY
+ * @param {number} maxX
+ * @param {number} maxY
+ * @param {callback<void>} [callback=undefined]
+ * @return {Promise<void>}
+ */
+GDAL_ASYNCABLE_DEFINE(Layer::setSpatialFilter) {
 
   Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(info.This());
   if (!layer->isAlive()) {
@@ -301,31 +847,38 @@ NAN_METHOD(Layer::setSpatialFilter) {
     return;
   }
 
-  if (info.Length() == 1) {
-    Geometry *filter = NULL;
-    NODE_ARG_WRAPPED_OPT(0, "filter", Geometry, filter);
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<int> job(layer->parent_uid);
 
-    GDAL_LOCK_PARENT(layer);
-    if (filter) {
-      layer->this_->SetSpatialFilter(filter->get());
-    } else {
-      layer->this_->SetSpatialFilter(NULL);
-    }
-  } else if (info.Length() == 4) {
+  if (info.Length() > 0 && info[0]->IsNumber()) {
     double minX, minY, maxX, maxY;
     NODE_ARG_DOUBLE(0, "minX", minX);
     NODE_ARG_DOUBLE(1, "minY", minY);
     NODE_ARG_DOUBLE(2, "maxX", maxX);
     NODE_ARG_DOUBLE(3, "maxY", maxY);
 
-    GDAL_LOCK_PARENT(layer);
-    layer->this_->SetSpatialFilterRect(minX, minY, maxX, maxY);
+    job.main = [gdal_layer, minX, minY, maxX, maxY](const GDALExecutionProgress &) {
+      gdal_layer->SetSpatialFilterRect(minX, minY, maxX, maxY);
+      return 0;
+    };
+  } else if (info.Length() > 0 && (async || info.Length() == 1)) {
+    Geometry *filter = NULL;
+    NODE_ARG_WRAPPED_OPT(0, "filter", Geometry, filter);
+
+    // The filter is cloned so that the Geometry can be modified
+    // while the operation is running
+    std::shared_ptr<OGRGeometry> geom(filter ? filter->get()->clone() : nullptr);
+    job.main = [gdal_layer, geom](const GDALExecutionProgress &) {
+      gdal_layer->SetSpatialFilter(geom.get());
+      return 0;
+    };
   } else {
     Nan::ThrowError("Invalid number of arguments");
     return;
   }
 
-  return;
+  job.rval = [](int, const GetFromPersistentFunc &) { return Nan::Undefined().As<Value>(); };
+  job.run(info, async, 4);
 }
 
 /**
@@ -352,7 +905,28 @@ NAN_METHOD(Layer::setSpatialFilter) {
  * @memberof Layer
  * @param {string|null} [filter=null]
  */
-NAN_METHOD(Layer::setAttributeFilter) {
+
+/**
+ * Sets the attribute query string to be used when fetching features via the
+ * `layer.features.next()` method. Only features for which the query evaluates
+ * as `true` will be returned.
+ * @async
+ *
+ * See {@link Layer.setAttributeFilter} for the format of the query string.
+ *
+ * @example
+ *
+ * await layer.setAttributeFilterAsync('population > 1000000 and population < 5000000');
+ *
+ * @throws {Error}
+ * @method setAttributeFilterAsync
+ * @instance
+ * @memberof Layer
+ * @param {string|null} [filter=null]
+ * @param {callback<void>} [callback=undefined]
+ * @return {Promise<void>}
+ */
+GDAL_ASYNCABLE_DEFINE(Layer::setAttributeFilter) {
 
   Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(info.This());
   if (!layer->isAlive()) {
@@ -363,20 +937,141 @@ NAN_METHOD(Layer::setAttributeFilter) {
   std::string filter = "";
   NODE_ARG_OPT_STR(0, "filter", filter);
 
-  OGRErr err;
-  GDAL_LOCK_PARENT(layer);
-  if (filter.empty()) {
-    err = layer->this_->SetAttributeFilter(NULL);
-  } else {
-    err = layer->this_->SetAttributeFilter(filter.c_str());
+  OGRLayer *gdal_layer = layer->get();
+  GDALAsyncableJob<OGRErr> job(layer->parent_uid);
+  job.main = [layer, gdal_layer, filter](const GDALExecutionProgress &) {
+    OGRErr err = gdal_layer->SetAttributeFilter(filter.empty() ? NULL : filter.c_str());
+    if (err) throw getOGRErrMsg(err);
+    layer->attribute_filter = filter;
+    return err;
+  };
+  job.rval = [](OGRErr, const GetFromPersistentFunc &) { return Nan::Undefined().As<Value>(); };
+  job.run(info, async, 1);
+}
+
+/**
+ * Sets the fields that will not be retrieved when reading the features.
+ *
+ * Many drivers, including Shapefile and GPKG, skip the decoding of the
+ * ignored fields entirely, which is much faster when reading only a few
+ * columns of a wide table. The ignored fields are set to `null` in the
+ * features and they are omitted by `fields.toObject()` and `fields.toArray()`.
+ *
+ * The special names `OGR_GEOMETRY` and `OGR_STYLE` ignore the geometry and
+ * the style of the features.
+ *
+ * @example
+ *
+ * layer.setIgnoredFields([ 'description', 'OGR_GEOMETRY' ]);
+ *
+ * @throws {Error}
+ * @method setIgnoredFields
+ * @instance
+ * @memberof Layer
+ * @param {string[]|null} fields Fields to ignore, `null` or an empty array to retrieve all fields
+ */
+NAN_METHOD(Layer::setIgnoredFields) {
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(info.This());
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object has already been destroyed");
+    return;
   }
 
+  std::vector<std::string> fields;
+  if (info.Length() > 0 && !info[0]->IsNull() && !info[0]->IsUndefined()) {
+    Local<Array> array;
+    NODE_ARG_ARRAY(0, "fields", array);
+    for (uint32_t i = 0; i < array->Length(); i++) {
+      Local<Value> name = Nan::Get(array, i).ToLocalChecked();
+      if (!name->IsString()) {
+        Nan::ThrowTypeError("fields must contain only strings");
+        return;
+      }
+      fields.push_back(*Nan::Utf8String(name));
+    }
+  }
+
+  CPLStringList list;
+  for (const std::string &name : fields) list.AddString(name.c_str());
+
+  GDAL_LOCK_PARENT(layer);
+  OGRErr err = layer->this_->SetIgnoredFields(const_cast<const char **>(list.List()));
   if (err) {
     NODE_THROW_OGRERR(err);
     return;
   }
+  layer->ignored_fields = fields;
+}
+
+/**
+ * Retrieves only the given fields when reading the features,
+ * all the other fields are ignored, see {@link Layer.setIgnoredFields}.
+ *
+ * The geometry is always retrieved unless `OGR_GEOMETRY` is
+ * explicitly ignored with {@link Layer.setIgnoredFields}.
+ *
+ * @example
+ *
+ * layer.selectFields([ 'name', 'population' ]);
+ * for (const feature of layer.features) {
+ *   console.log(feature.fields.toObject()); // { name, population }
+ * }
+ *
+ * @throws {Error}
+ * @method selectFields
+ * @instance
+ * @memberof Layer
+ * @param {string[]|null} fields Fields to retrieve, `null` to retrieve all fields
+ */
+NAN_METHOD(Layer::selectFields) {
+  Layer *layer = Nan::ObjectWrap::Unwrap<Layer>(info.This());
+  if (!layer->isAlive()) {
+    Nan::ThrowError("Layer object has already been destroyed");
+    return;
+  }
+
+  bool all_fields = true;
+  std::vector<std::string> selected;
+  if (info.Length() > 0 && !info[0]->IsNull() && !info[0]->IsUndefined()) {
+    Local<Array> array;
+    NODE_ARG_ARRAY(0, "fields", array);
+    all_fields = false;
+    for (uint32_t i = 0; i < array->Length(); i++) {
+      Local<Value> name = Nan::Get(array, i).ToLocalChecked();
+      if (!name->IsString()) {
+        Nan::ThrowTypeError("fields must contain only strings");
+        return;
+      }
+      selected.push_back(*Nan::Utf8String(name));
+    }
+  }
 
-  return;
+  GDAL_LOCK_PARENT(layer);
+  OGRFeatureDefn *defn = layer->this_->GetLayerDefn();
+  std::vector<bool> keep(defn->GetFieldCount(), all_fields);
+  for (const std::string &name : selected) {
+    int i = defn->GetFieldIndex(name.c_str());
+    if (i < 0) {
+      Nan::ThrowError(("Field '" + name + "' does not exist").c_str());
+      return;
+    }
+    keep[i] = true;
+  }
+
+  std::vector<std::string> fields;
+  CPLStringList list;
+  for (int i = 0; i < defn->GetFieldCount(); i++) {
+    if (keep[i]) continue;
+    fields.push_back(defn->GetFieldDefn(i)->GetNameRef());
+    list.AddString(defn->GetFieldDefn(i)->GetNameRef());
+  }
+
+  OGRErr err = layer->this_->SetIgnoredFields(const_cast<const char **>(list.List()));
+  if (err) {
+    NODE_THROW_OGRERR(err);
+    return;
+  }
+  layer->ignored_fields = fields;
 }
 
 /*
@@ -26,12 +26,16 @@ class Layer : public Nan::ObjectWrap {
   static Local<Value> New(OGRLayer *raw, GDALDataset *raw_parent);
   static Local<Value> New(OGRLayer *raw, GDALDataset *raw_parent, bool result_set);
   static NAN_METHOD(toString);
-  static NAN_METHOD(getExtent);
-  static NAN_METHOD(setAttributeFilter);
-  static NAN_METHOD(setSpatialFilter);
+  GDAL_ASYNCABLE_DECLARE(getExtent);
+  GDAL_ASYNCABLE_DECLARE(setAttributeFilter);
+  GDAL_ASYNCABLE_DECLARE(setSpatialFilter);
   static NAN_METHOD(getSpatialFilter);
+  static NAN_METHOD(setIgnoredFields);
+  static NAN_METHOD(selectFields);
   static NAN_METHOD(testCapability);
   GDAL_ASYNCABLE_DECLARE(syncToDisk);
+  GDAL_ASYNCABLE_DECLARE(getArrowStream);
+  GDAL_ASYNCABLE_DECLARE(writeBatch);
 
   static NAN_SETTER(dsSetter);
   static NAN_GETTER(dsGetter);
@@ -58,6 +62,11 @@ class Layer : public Nan::ObjectWrap {
   void dispose();
   long uid;
   long parent_uid;
+  // the fields set with setIgnoredFields() / selectFields()
+  std::vector<std::string> ignored_fields;
+  // the filter set with setAttributeFilter(), GDAL has no getter for it
+  // (modified and read only with the Dataset locked)
+  std::string attribute_filter;
 
     private:
   ~Layer();
@@ -162,15 +162,21 @@ NAN_METHOD(RasterBand::toString) {
 
 /**
  * Saves changes to disk.
+ *
+ * Throws if blocks returned by `readBlockRef()` are still referenced.
+ *
  * @method flush
  * @instance
  * @memberof RasterBand
+ * @throws {Error}
  */
 
 /**
  * Saves changes to disk.
  * @async
  *
+ * Rejects if blocks returned by `readBlockRef()` are still referenced.
+ *
  * @method flushAsync
  * @instance
  * @memberof RasterBand
@@ -178,7 +184,27 @@ NAN_METHOD(RasterBand::toString) {
  * @return {Promise<void>}
  *
  */
-NODE_WRAPPED_ASYNC_METHOD_WITH_OGRERR_RESULT_LOCKED(RasterBand, flush, FlushCache);
+GDAL_ASYNCABLE_DEFINE(RasterBand::flush) {
+  NODE_UNWRAP_CHECK(RasterBand, info.This(), band);
+  std::shared_ptr<DatasetResources> resources;
+  try {
+    resources = object_store.getResources(band->parent_uid);
+  } catch (const char *msg) {
+    Nan::ThrowError(msg);
+    return;
+  }
+  GDALRasterBand *gdal_band = band->get();
+  GDALAsyncableJob<CPLErr> job(band->parent_uid);
+  job.main = [gdal_band, resources](const GDALExecutionProgress &) {
+    object_store.checkNotPinned(resources);
+    CPLErrorReset();
+    CPLErr err = gdal_band->FlushCache();
+    if (err != CE_None) throw CPLGetLastErrorMsg();
+    return err;
+  };
+  job.rval = [](CPLErr, const GetFromPersistentFunc &) { return Nan::Undefined().As<Value>(); };
+  job.run(info, async, 0);
+}
 
 /**
  * Return the status flags of the mask band associated with the band.
@@ -718,10 +744,11 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::sizeGetter) {
     int x, y;
   };
   GDALAsyncableJob<xy> job(band->parent_uid);
+  job.readOnly = band->hasReaders();
   job.main = [raw](const GDALExecutionProgress &) {
     xy r;
-    r.x = raw->GetXSize();
-    r.y = raw->GetYSize();
+    r.x = readerBand(raw)->GetXSize();
+    r.y = readerBand(raw)->GetYSize();
     return r;
   };
   job.rval = [](xy r, const GetFromPersistentFunc &) {
@@ -764,9 +791,10 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::blockSizeGetter) {
     int x, y;
   };
   GDALAsyncableJob<xy> job(band->parent_uid);
+  job.readOnly = band->hasReaders();
   job.main = [raw](const GDALExecutionProgress &) {
     xy r;
-    raw->GetBlockSize(&r.x, &r.y);
+    readerBand(raw)->GetBlockSize(&r.x, &r.y);
     return r;
   };
   job.rval = [](xy r, const GetFromPersistentFunc &) {
@@ -890,10 +918,11 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::offsetGetter) {
   GDAL_RAW_CHECK_ASYNC(GDALRasterBand *, band, raw);
 
   GDALAsyncableJob<MaybeResult<double>> job(band->parent_uid);
+  job.readOnly = band->hasReaders();
   job.main = [raw](const GDALExecutionProgress &) {
     MaybeResult<double> r;
     CPLErrorReset();
-    r.value = raw->GetOffset(&r.success);
+    r.value = readerBand(raw)->GetOffset(&r.success);
     return r;
   };
   job.rval = [](MaybeResult<double> r, const GetFromPersistentFunc &) {
@@ -929,10 +958,11 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::scaleGetter) {
   GDAL_RAW_CHECK_ASYNC(GDALRasterBand *, band, raw);
 
   GDALAsyncableJob<MaybeResult<double>> job(band->parent_uid);
+  job.readOnly = band->hasReaders();
   job.main = [raw](const GDALExecutionProgress &) {
     MaybeResult<double> r;
     CPLErrorReset();
-    r.value = raw->GetScale(&r.success);
+    r.value = readerBand(raw)->GetScale(&r.success);
     return r;
   };
   job.rval = [](MaybeResult<double> r, const GetFromPersistentFunc &) {
@@ -968,10 +998,11 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::noDataValueGetter) {
   GDAL_RAW_CHECK_ASYNC(GDALRasterBand *, band, raw);
 
   GDALAsyncableJob<MaybeResult<double>> job(band->parent_uid);
+  job.readOnly = band->hasReaders();
   job.main = [raw](const GDALExecutionProgress &) {
     MaybeResult<double> r;
     CPLErrorReset();
-    r.value = raw->GetNoDataValue(&r.success);
+    r.value = readerBand(raw)->GetNoDataValue(&r.success);
     return r;
   };
   job.rval = [](MaybeResult<double> r, const GetFromPersistentFunc &) {
@@ -1014,12 +1045,13 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::unitTypeGetter) {
   NODE_UNWRAP_CHECK_ASYNC(RasterBand, info.This(), band);
   GDAL_RAW_CHECK_ASYNC(GDALRasterBand *, band, raw);
 
-  GDALAsyncableJob<const char *> job(band->parent_uid);
+  GDALAsyncableJob<std::string> job(band->parent_uid);
+  job.readOnly = band->hasReaders();
   job.main = [raw](const GDALExecutionProgress &) {
     CPLErrorReset();
-    return raw->GetUnitType();
+    return std::string(readerBand(raw)->GetUnitType());
   };
-  job.rval = [](const char *r, const GetFromPersistentFunc &) { return SafeString::New(r); };
+  job.rval = [](std::string r, const GetFromPersistentFunc &) { return SafeString::New(r.c_str()); };
   job.run(info, async);
 }
 
@@ -1052,9 +1084,10 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::dataTypeGetter) {
   GDAL_RAW_CHECK_ASYNC(GDALRasterBand *, band, raw);
 
   GDALAsyncableJob<GDALDataType> job(band->parent_uid);
+  job.readOnly = band->hasReaders();
   job.main = [raw](const GDALExecutionProgress &) {
     CPLErrorReset();
-    return raw->GetRasterDataType();
+    return readerBand(raw)->GetRasterDataType();
   };
   job.rval = [](GDALDataType type, const GetFromPersistentFunc &) {
     if (type == GDT_Unknown) return Nan::Null().As<Value>();
@@ -1233,6 +1266,7 @@ GDAL_ASYNCABLE_GETTER_DEFINE(RasterBand::colorInterpretationGetter) {
 
 NAN_SETTER(RasterBand::unitTypeSetter) {
   NODE_UNWRAP_CHECK(RasterBand, info.This(), band);
+  GDAL_POOL_CHECK(band->parent_uid);
   if (!value->IsString()) {
     Nan::ThrowError("Unit type must be a string");
     return;
@@ -1245,6 +1279,7 @@ NAN_SETTER(RasterBand::unitTypeSetter) {
 
 NAN_SETTER(RasterBand::noDataValueSetter) {
   NODE_UNWRAP_CHECK(RasterBand, info.This(), band);
+  GDAL_POOL_CHECK(band->parent_uid);
 
   CPLErr err;
   GDAL_LOCK_PARENT(band);
@@ -1263,6 +1298,7 @@ NAN_SETTER(RasterBand::noDataValueSetter) {
 
 NAN_SETTER(RasterBand::scaleSetter) {
   NODE_UNWRAP_CHECK(RasterBand, info.This(), band);
+  GDAL_POOL_CHECK(band->parent_uid);
 
   if (!value->IsNumber()) {
     Nan::ThrowError("Scale must be a number");
@@ -1276,6 +1312,7 @@ NAN_SETTER(RasterBand::scaleSetter) {
 
 NAN_SETTER(RasterBand::offsetSetter) {
   NODE_UNWRAP_CHECK(RasterBand, info.This(), band);
+  GDAL_POOL_CHECK(band->parent_uid);
 
   if (!value->IsNumber()) {
     Nan::ThrowError("Offset must be a number");
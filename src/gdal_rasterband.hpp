@@ -78,6 +78,11 @@ class RasterBand : public Nan::ObjectWrap {
   inline GDALDataset *getParent() {
     return parent_ds;
   }
+  // Only the bands of the Dataset itself exist in its reader handles,
+  // overviews and masks are always read from the main handle
+  inline bool hasReaders() {
+    return this_->GetBand() > 0 && this_->GetDataset() == parent_ds;
+  }
   void dispose();
   long uid;
   // Dataset that will be locked
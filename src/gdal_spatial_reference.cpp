@@ -1,7 +1,9 @@
 
+#include <memory>
 #include "gdal_spatial_reference.hpp"
 #include "gdal_common.hpp"
 #include "utils/string_list.hpp"
+#include "utils/srs_cache.hpp"
 #include "async.hpp"
 
 namespace node_gdal {
@@ -16,11 +18,11 @@ void SpatialReference::Initialize(Local<Object> target) {
   lcons->SetClassName(Nan::New("SpatialReference").ToLocalChecked());
 
   Nan__SetAsyncableMethod(lcons, "fromUserInput", fromUserInput);
-  Nan::SetMethod(lcons, "fromWKT", fromWKT);
-  Nan::SetMethod(lcons, "fromProj4", fromProj4);
-  Nan::SetMethod(lcons, "fromEPSG", fromEPSG);
-  Nan::SetMethod(lcons, "fromEPSGA", fromEPSGA);
-  Nan::SetMethod(lcons, "fromESRI", fromESRI);
+  Nan__SetAsyncableMethod(lcons, "fromWKT", fromWKT);
+  Nan__SetAsyncableMethod(lcons, "fromProj4", fromProj4);
+  Nan__SetAsyncableMethod(lcons, "fromEPSG", fromEPSG);
+  Nan__SetAsyncableMethod(lcons, "fromEPSGA", fromEPSGA);
+  Nan__SetAsyncableMethod(lcons, "fromESRI", fromESRI);
   Nan::SetMethod(lcons, "fromWMSAUTO", fromWMSAUTO);
   Nan::SetMethod(lcons, "fromXML", fromXML);
   Nan::SetMethod(lcons, "fromURN", fromURN);
@@ -57,7 +59,7 @@ void SpatialReference::Initialize(Local<Object> target) {
   Nan::SetPrototypeMethod(lcons, "getAuthorityCode", getAuthorityCode);
   Nan::SetPrototypeMethod(lcons, "getAttrValue", getAttrValue);
   Nan::SetPrototypeMethod(lcons, "autoIdentifyEPSG", autoIdentifyEPSG);
-  Nan::SetPrototypeMethod(lcons, "validate", validate);
+  Nan__SetPrototypeAsyncableMethod(lcons, "validate", validate);
 
   Nan::Set(target, Nan::New("SpatialReference").ToLocalChecked(), Nan::GetFunction(lcons).ToLocalChecked());
 
@@ -548,21 +550,40 @@ NAN_METHOD(SpatialReference::getAttrValue) {
  * @param {string} wkt
  * @return {SpatialReference}
  */
-NAN_METHOD(SpatialReference::fromWKT) {
+
+/**
+ * Creates a spatial reference from a WKT string.
+ * @async
+ *
+ * @static
+ * @throws {Error}
+ * @method fromWKTAsync
+ * @instance
+ * @memberof SpatialReference
+ * @param {string} wkt
+ * @param {callback<SpatialReference>} [callback=undefined]
+ * @return {Promise<SpatialReference>}
+ */
+GDAL_ASYNCABLE_DEFINE(SpatialReference::fromWKT) {
 
   std::string wkt("");
   NODE_ARG_STR(0, "wkt", wkt);
-  OGRChar *str = (OGRChar *)wkt.c_str();
 
-  OGRSpatialReference *srs = new OGRSpatialReference();
-  int err = srs->importFromWkt(&str);
-  if (err) {
-    delete srs;
-    NODE_THROW_OGRERR(err);
-    return;
-  }
+  GDALAsyncableJob<OGRSpatialReference *> job(0);
 
-  info.GetReturnValue().Set(SpatialReference::New(srs, true));
+  job.main = [wkt](const GDALExecutionProgress &) {
+    std::string input(wkt);
+    OGRChar *str = (OGRChar *)input.c_str();
+    OGRSpatialReference *srs = new OGRSpatialReference();
+    int err = srs->importFromWkt(&str);
+    if (err) {
+      delete srs;
+      throw getOGRErrMsg(err);
+    }
+    return srs;
+  };
+  job.rval = [](OGRSpatialReference *srs, const GetFromPersistentFunc &) { return SpatialReference::New(srs, true); };
+  job.run(info, async, 1);
 }
 
 /**
@@ -576,20 +597,38 @@ NAN_METHOD(SpatialReference::fromWKT) {
  * @param {string} input
  * @return {SpatialReference}
  */
-NAN_METHOD(SpatialReference::fromProj4) {
+
+/**
+ * Creates a spatial reference from a Proj.4 string.
+ * @async
+ *
+ * @static
+ * @throws {Error}
+ * @method fromProj4Async
+ * @instance
+ * @memberof SpatialReference
+ * @param {string} input
+ * @param {callback<SpatialReference>} [callback=undefined]
+ * @return {Promise<SpatialReference>}
+ */
+GDAL_ASYNCABLE_DEFINE(SpatialReference::fromProj4) {
 
   std::string input("");
   NODE_ARG_STR(0, "input", input);
 
-  OGRSpatialReference *srs = new OGRSpatialReference();
-  int err = srs->importFromProj4(input.c_str());
-  if (err) {
-    delete srs;
-    NODE_THROW_OGRERR(err);
-    return;
-  }
+  GDALAsyncableJob<OGRSpatialReference *> job(0);
 
-  info.GetReturnValue().Set(SpatialReference::New(srs, true));
+  job.main = [input](const GDALExecutionProgress &) {
+    OGRSpatialReference *srs = new OGRSpatialReference();
+    int err = srs->importFromProj4(input.c_str());
+    if (err) {
+      delete srs;
+      throw getOGRErrMsg(err);
+    }
+    return srs;
+  };
+  job.rval = [](OGRSpatialReference *srs, const GetFromPersistentFunc &) { return SpatialReference::New(srs, true); };
+  job.run(info, async, 1);
 }
 
 /**
@@ -854,12 +893,16 @@ GDAL_ASYNCABLE_DEFINE(SpatialReference::fromUserInput) {
   GDALAsyncableJob<OGRSpatialReference *> job(0);
 
   job.main = [input](const GDALExecutionProgress &progress) {
-    OGRSpatialReference *srs = new OGRSpatialReference();
+    std::string key = "input:" + input;
+    OGRSpatialReference *srs = srs_cache.getSRS(key);
+    if (srs != nullptr) return srs;
+    srs = new OGRSpatialReference();
     int err = srs->SetFromUserInput(input.c_str());
     if (err) {
       delete srs;
       throw getOGRErrMsg(err);
     }
+    srs_cache.putSRS(key, srs);
     return srs;
   };
   job.rval = [](OGRSpatialReference *srs, const GetFromPersistentFunc &) { return SpatialReference::New(srs, true); };
@@ -881,20 +924,46 @@ GDAL_ASYNCABLE_DEFINE(SpatialReference::fromUserInput) {
  * @param {number} input
  * @return {SpatialReference}
  */
-NAN_METHOD(SpatialReference::fromEPSG) {
+
+/**
+ * Initialize from EPSG GCS or PCS code.
+ * @async
+ *
+ * @example
+ *
+ * var ref = await gdal.SpatialReference.fromEPSGAsync(4326);
+ *
+ * @static
+ * @throws {Error}
+ * @method fromEPSGAsync
+ * @instance
+ * @memberof SpatialReference
+ * @param {number} input
+ * @param {callback<SpatialReference>} [callback=undefined]
+ * @return {Promise<SpatialReference>}
+ */
+GDAL_ASYNCABLE_DEFINE(SpatialReference::fromEPSG) {
 
   int epsg;
   NODE_ARG_INT(0, "epsg", epsg);
 
-  OGRSpatialReference *srs = new OGRSpatialReference();
-  int err = srs->importFromEPSG(epsg);
-  if (err) {
-    delete srs;
-    NODE_THROW_OGRERR(err);
-    return;
-  }
+  GDALAsyncableJob<OGRSpatialReference *> job(0);
 
-  info.GetReturnValue().Set(SpatialReference::New(srs, true));
+  job.main = [epsg](const GDALExecutionProgress &) {
+    std::string key = "fromEPSG:" + std::to_string(epsg);
+    OGRSpatialReference *srs = srs_cache.getSRS(key);
+    if (srs != nullptr) return srs;
+    srs = new OGRSpatialReference();
+    int err = srs->importFromEPSG(epsg);
+    if (err) {
+      delete srs;
+      throw getOGRErrMsg(err);
+    }
+    srs_cache.putSRS(key, srs);
+    return srs;
+  };
+  job.rval = [](OGRSpatialReference *srs, const GetFromPersistentFunc &) { return SpatialReference::New(srs, true); };
+  job.run(info, async, 1);
 }
 
 /**
@@ -918,20 +987,49 @@ NAN_METHOD(SpatialReference::fromEPSG) {
  * @param {number} input
  * @return {SpatialReference}
  */
-NAN_METHOD(SpatialReference::fromEPSGA) {
+
+/**
+ * Initialize from EPSG GCS or PCS code.
+ * @async
+ *
+ * This method is similar to `fromEPSGAsync()` except that EPSG preferred axis
+ * ordering *will* be applied for geographic and projected coordinate systems.
+ *
+ * @example
+ *
+ * var ref = await gdal.SpatialReference.fromEPSGAAsync(26910);
+ *
+ * @static
+ * @throws {Error}
+ * @method fromEPSGAAsync
+ * @instance
+ * @memberof SpatialReference
+ * @param {number} input
+ * @param {callback<SpatialReference>} [callback=undefined]
+ * @return {Promise<SpatialReference>}
+ */
+GDAL_ASYNCABLE_DEFINE(SpatialReference::fromEPSGA) {
 
   int epsg;
   NODE_ARG_INT(0, "epsg", epsg);
 
-  OGRSpatialReference *srs = new OGRSpatialReference();
-  int err = srs->importFromEPSGA(epsg);
-  if (err) {
-    delete srs;
-    NODE_THROW_OGRERR(err);
-    return;
-  }
+  GDALAsyncableJob<OGRSpatialReference *> job(0);
 
-  info.GetReturnValue().Set(SpatialReference::New(srs, true));
+  job.main = [epsg](const GDALExecutionProgress &) {
+    std::string key = "fromEPSGA:" + std::to_string(epsg);
+    OGRSpatialReference *srs = srs_cache.getSRS(key);
+    if (srs != nullptr) return srs;
+    srs = new OGRSpatialReference();
+    int err = srs->importFromEPSGA(epsg);
+    if (err) {
+      delete srs;
+      throw getOGRErrMsg(err);
+    }
+    srs_cache.putSRS(key, srs);
+    return srs;
+  };
+  job.rval = [](OGRSpatialReference *srs, const GetFromPersistentFunc &) { return SpatialReference::New(srs, true); };
+  job.run(info, async, 1);
 }
 
 /**
@@ -957,28 +1055,50 @@ NAN_METHOD(SpatialReference::fromEPSGA) {
  * @param {object|string[]} input
  * @return {SpatialReference}
  */
-NAN_METHOD(SpatialReference::fromESRI) {
 
-  StringList list;
+/**
+ * Import coordinate system from ESRI .prj format(s).
+ * @async
+ *
+ * See `fromESRI()` for the supported formats.
+ *
+ * @static
+ * @throws {Error}
+ * @method fromESRIAsync
+ * @instance
+ * @memberof SpatialReference
+ * @param {object|string[]} input
+ * @param {callback<SpatialReference>} [callback=undefined]
+ * @return {Promise<SpatialReference>}
+ */
+GDAL_ASYNCABLE_DEFINE(SpatialReference::fromESRI) {
 
   if (info.Length() < 1) {
     Nan::ThrowError("input string list must be provided");
     return;
   }
 
-  if (list.parse(info[0])) {
+  // Very careful here
+  // we can't reference automatic variables, thus the shared list object
+  // which is freed with the job, even if it never runs
+  std::shared_ptr<StringList> list = std::make_shared<StringList>();
+  if (list->parse(info[0])) {
     return; // error parsing string list
   }
 
-  OGRSpatialReference *srs = new OGRSpatialReference();
-  int err = srs->importFromESRI(list.get());
-  if (err) {
-    delete srs;
-    NODE_THROW_OGRERR(err);
-    return;
-  }
+  GDALAsyncableJob<OGRSpatialReference *> job(0);
 
-  info.GetReturnValue().Set(SpatialReference::New(srs, true));
+  job.main = [list](const GDALExecutionProgress &) {
+    OGRSpatialReference *srs = new OGRSpatialReference();
+    int err = srs->importFromESRI(list->get());
+    if (err) {
+      delete srs;
+      throw getOGRErrMsg(err);
+    }
+    return srs;
+  };
+  job.rval = [](OGRSpatialReference *srs, const GetFromPersistentFunc &) { return SpatialReference::New(srs, true); };
+  job.run(info, async, 1);
 }
 
 /**
@@ -1042,27 +1162,47 @@ NAN_METHOD(SpatialReference::getAngularUnits) {
  * @memberof SpatialReference
  * @return {string|null} `"corrupt"`, '"unsupported"', `null` (if fine)
  */
-NAN_METHOD(SpatialReference::validate) {
 
-  SpatialReference *srs = Nan::ObjectWrap::Unwrap<SpatialReference>(info.This());
+/**
+ * Validate SRS tokens.
+ * @async
+ *
+ * This method attempts to verify that the spatial reference system is well
+ * formed, and consists of known tokens. The validation is not comprehensive.
+ *
+ * @method validateAsync
+ * @instance
+ * @memberof SpatialReference
+ * @param {callback<string|null>} [callback=undefined]
+ * @return {Promise<string|null>} `"corrupt"`, '"unsupported"', `null` (if fine)
+ */
+GDAL_ASYNCABLE_DEFINE(SpatialReference::validate) {
 
-  OGRErr err = srs->this_->Validate();
+  SpatialReference *srs = Nan::ObjectWrap::Unwrap<SpatialReference>(info.This());
 
-  if (err == OGRERR_NONE) {
-    info.GetReturnValue().Set(Nan::Null());
-    return;
-  }
-  if (err == OGRERR_CORRUPT_DATA) {
-    info.GetReturnValue().Set(Nan::New("corrupt").ToLocalChecked());
-    return;
-  }
-  if (err == OGRERR_UNSUPPORTED_SRS) {
-    info.GetReturnValue().Set(Nan::New("unsupported").ToLocalChecked());
-    return;
+  // The background thread works on a copy as the SpatialReference can be modified in the meantime,
+  // it is owned by the job and freed with it, even if it never runs
+  OGRSpatialReference *raw = srs->this_;
+  std::shared_ptr<OGRSpatialReference> owned;
+  if (async) {
+    owned.reset(raw->Clone(), OGRSpatialReference::DestroySpatialReference);
+    raw = owned.get();
   }
 
-  NODE_THROW_OGRERR(err);
-  return;
+  GDALAsyncableJob<OGRErr> job(0);
+
+  job.main = [raw, owned](const GDALExecutionProgress &) {
+    OGRErr err = raw->Validate();
+    if (err != OGRERR_NONE && err != OGRERR_CORRUPT_DATA && err != OGRERR_UNSUPPORTED_SRS) throw getOGRErrMsg(err);
+    return err;
+  };
+  job.rval = [](OGRErr err, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    if (err == OGRERR_CORRUPT_DATA) return scope.Escape(Nan::New("corrupt").ToLocalChecked().As<Value>());
+    if (err == OGRERR_UNSUPPORTED_SRS) return scope.Escape(Nan::New("unsupported").ToLocalChecked().As<Value>());
+    return scope.Escape(Nan::Null().As<Value>());
+  };
+  job.run(info, async, 0);
 }
 
 } // namespace node_gdal
@@ -59,14 +59,14 @@ class SpatialReference : public Nan::ObjectWrap {
   static NAN_METHOD(getAuthorityCode);
   static NAN_METHOD(getAuthorityName);
   static NAN_METHOD(getAttrValue);
-  static NAN_METHOD(validate);
+  GDAL_ASYNCABLE_DECLARE(validate);
 
   GDAL_ASYNCABLE_DECLARE(fromUserInput);
-  static NAN_METHOD(fromWKT);
-  static NAN_METHOD(fromProj4);
-  static NAN_METHOD(fromEPSG);
-  static NAN_METHOD(fromEPSGA);
-  static NAN_METHOD(fromESRI);
+  GDAL_ASYNCABLE_DECLARE(fromWKT);
+  GDAL_ASYNCABLE_DECLARE(fromProj4);
+  GDAL_ASYNCABLE_DECLARE(fromEPSG);
+  GDAL_ASYNCABLE_DECLARE(fromEPSGA);
+  GDAL_ASYNCABLE_DECLARE(fromESRI);
   static NAN_METHOD(fromWMSAUTO);
   static NAN_METHOD(fromXML);
   static NAN_METHOD(fromURN);
@@ -17,9 +17,11 @@
 
 #include <node_buffer.h>
 #include <ogr_core.h>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <stdlib.h>
+#include <vector>
 
 namespace node_gdal {
 
@@ -37,6 +39,7 @@ void Geometry::Initialize(Local<Object> target) {
   Nan__SetAsyncableMethod(lcons, "fromWKB", Geometry::createFromWkb);
   Nan__SetAsyncableMethod(lcons, "fromGeoJson", Geometry::createFromGeoJson);
   Nan__SetAsyncableMethod(lcons, "fromGeoJsonBuffer", Geometry::createFromGeoJsonBuffer);
+  Nan__SetAsyncableMethod(lcons, "fromCoordinates", Geometry::createFromCoordinates);
   Nan::SetMethod(lcons, "getName", Geometry::getName);
   Nan::SetMethod(lcons, "getConstructor", Geometry::getConstructor);
 
@@ -76,6 +79,7 @@ void Geometry::Initialize(Local<Object> target) {
   Nan__SetPrototypeAsyncableMethod(lcons, "swapXY", swapXY);
   Nan__SetPrototypeAsyncableMethod(lcons, "getEnvelope", getEnvelope);
   Nan__SetPrototypeAsyncableMethod(lcons, "getEnvelope3D", getEnvelope3D);
+  Nan__SetPrototypeAsyncableMethod(lcons, "getCoordinates", getCoordinates);
   Nan__SetPrototypeAsyncableMethod(lcons, "flattenTo2D", flattenTo2D);
   Nan__SetPrototypeAsyncableMethod(lcons, "transform", transform);
   Nan__SetPrototypeAsyncableMethod(lcons, "transformTo", transformTo);
@@ -1505,6 +1509,203 @@ GDAL_ASYNCABLE_DEFINE(Geometry::getEnvelope3D) {
   job.run(info, async, 0);
 }
 
+// Holds the semaphore of a Geometry for the lifetime of the object
+class uv_scoped_sem {
+    public:
+  inline uv_scoped_sem(uv_sem_t *sem) : sem(sem) {
+    uv_sem_wait(sem);
+  }
+  inline ~uv_scoped_sem() {
+    uv_sem_post(sem);
+  }
+
+    private:
+  uv_sem_t *sem;
+};
+
+// Flat coordinates of a geometry, see Geometry.getCoordinates()
+struct FlatCoordinates {
+  int dims;
+  std::vector<double> coordinates;
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> parts;
+};
+
+// The offsets are 32-bit
+static inline void addVertex(FlatCoordinates &flat, double x, double y, double z) {
+  if (flat.coordinates.size() / flat.dims >= UINT32_MAX) throw "Geometry has too many vertices";
+  flat.coordinates.push_back(x);
+  flat.coordinates.push_back(y);
+  if (flat.dims == 3) flat.coordinates.push_back(z);
+}
+
+static inline void endRing(FlatCoordinates &flat) {
+  flat.offsets.push_back(static_cast<uint32_t>(flat.coordinates.size() / flat.dims));
+}
+
+static inline void endPart(FlatCoordinates &flat) {
+  flat.parts.push_back(static_cast<uint32_t>(flat.offsets.size() - 1));
+}
+
+static void addCurve(FlatCoordinates &flat, const OGRCurve *curve) {
+  OGRwkbGeometryType type = wkbFlatten(curve->getGeometryType());
+  if (type == wkbLineString || type == wkbLinearRing || type == wkbCircularString) {
+    const OGRSimpleCurve *simple = static_cast<const OGRSimpleCurve *>(curve);
+    int n = simple->getNumPoints();
+    flat.coordinates.reserve(flat.coordinates.size() + static_cast<size_t>(n) * flat.dims);
+    for (int i = 0; i < n; i++) addVertex(flat, simple->getX(i), simple->getY(i), simple->getZ(i));
+  } else {
+    OGRPointIterator *it = curve->getPointIterator();
+    OGRPoint pt;
+    while (it->getNextPoint(&pt)) addVertex(flat, pt.getX(), pt.getY(), pt.getZ());
+    delete it;
+  }
+  endRing(flat);
+}
+
+// Every point, curve or surface is a part, collections are flattened
+static void addGeometry(FlatCoordinates &flat, const OGRGeometry *geom) {
+  OGRwkbGeometryType type = wkbFlatten(geom->getGeometryType());
+  if (type == wkbPoint) {
+    const OGRPoint *pt = static_cast<const OGRPoint *>(geom);
+    if (!pt->IsEmpty()) addVertex(flat, pt->getX(), pt->getY(), pt->getZ());
+    endRing(flat);
+    endPart(flat);
+  } else if (OGR_GT_IsCurve(type)) {
+    addCurve(flat, static_cast<const OGRCurve *>(geom));
+    endPart(flat);
+  } else if (OGR_GT_IsSubClassOf(type, wkbCurvePolygon)) {
+    const OGRCurvePolygon *poly = static_cast<const OGRCurvePolygon *>(geom);
+    if (poly->getExteriorRingCurve() != nullptr) addCurve(flat, poly->getExteriorRingCurve());
+    for (int i = 0; i < poly->getNumInteriorRings(); i++) addCurve(flat, poly->getInteriorRingCurve(i));
+    endPart(flat);
+  } else if (OGR_GT_IsSubClassOf(type, wkbGeometryCollection)) {
+    const OGRGeometryCollection *coll = static_cast<const OGRGeometryCollection *>(geom);
+    for (int i = 0; i < coll->getNumGeometries(); i++) addGeometry(flat, coll->getGeometryRef(i));
+  } else if (OGR_GT_IsSubClassOf(type, wkbPolyhedralSurface)) {
+    const OGRPolyhedralSurface *surface = static_cast<const OGRPolyhedralSurface *>(geom);
+    for (int i = 0; i < surface->getNumGeometries(); i++) addGeometry(flat, surface->getGeometryRef(i));
+  } else {
+    CPLError(CE_Failure, CPLE_NotSupported, "Unsupported geometry type %s", OGRGeometryTypeToName(type));
+    throw CPLGetLastErrorMsg();
+  }
+}
+
+/**
+ * @typedef {object} GeometryCoordinatesOptions
+ * @property {number} [dims]
+ */
+
+/**
+ * @typedef {object} GeometryCoordinates
+ * @property {number} dims Number of values per vertex, `2` or `3`
+ * @property {Float64Array} coordinates Interleaved coordinates of all the vertices
+ * @property {Uint32Array} offsets Index of the first vertex of each ring, line or point, followed by the total number of vertices
+ * @property {Uint32Array} parts Index of the first ring of each part (point, line or polygon), followed by the total number of rings
+ */
+
+/**
+ * Exports all the coordinates of the geometry in a flat `Float64Array`
+ * in a single operation.
+ *
+ * The vertices of ring `i` are `coordinates[offsets[i] * dims ... offsets[i + 1] * dims]`
+ * and the rings of part `j` are `offsets[parts[j] ... parts[j + 1]]`. A point or
+ * a line has one ring, a polygon has its exterior ring followed by its interior rings,
+ * collections are flattened and curves are returned as their control points.
+ *
+ * @example
+ *
+ * const { coordinates, offsets, parts } = multiPolygon.getCoordinates({ dims: 2 });
+ * for (let j = 0; j < parts.length - 1; j++) {
+ *   for (let i = parts[j]; i < parts[j + 1]; i++) {
+ *     const ring = coordinates.subarray(offsets[i] * 2, offsets[i + 1] * 2);
+ *   }
+ * }
+ *
+ * @method getCoordinates
+ * @instance
+ * @memberof Geometry
+ * @param {GeometryCoordinatesOptions} [options]
+ * @param {number} [options.dims] `2` or `3`, defaults to the coordinate dimension of the geometry
+ * @throws {Error}
+ * @return {GeometryCoordinates}
+ */
+
+/**
+ * Exports all the coordinates of the geometry in a flat `Float64Array`
+ * in a single operation.
+ * @async
+ *
+ * See `getCoordinates()` for the layout of the data.
+ *
+ * @method getCoordinatesAsync
+ * @instance
+ * @memberof Geometry
+ * @param {GeometryCoordinatesOptions} [options]
+ * @param {number} [options.dims] `2` or `3`, defaults to the coordinate dimension of the geometry
+ * @param {callback<GeometryCoordinates>} [callback=undefined]
+ * @throws {Error}
+ * @return {Promise<GeometryCoordinates>}
+ */
+GDAL_ASYNCABLE_DEFINE(Geometry::getCoordinates) {
+  Geometry *geom = Nan::ObjectWrap::Unwrap<Geometry>(info.This());
+
+  Local<Object> options;
+  int dims = 0;
+  NODE_ARG_OBJECT_OPT(0, "options", options);
+  if (!options.IsEmpty()) { NODE_INT_FROM_OBJ_OPT(options, "dims", dims); }
+  if (dims != 0 && dims != 2 && dims != 3) {
+    Nan::ThrowRangeError("dims must be 2 or 3");
+    return;
+  }
+
+  OGRGeometry *gdal_geom = geom->this_;
+  uv_sem_t *async_lock = geom->async_lock;
+
+  GDALAsyncableJob<std::shared_ptr<FlatCoordinates>> job(0);
+  job.main = [async_lock, gdal_geom, dims](const GDALExecutionProgress &) {
+    std::shared_ptr<FlatCoordinates> flat = std::make_shared<FlatCoordinates>();
+    uv_scoped_sem lock(async_lock);
+    flat->dims = dims != 0 ? dims : (gdal_geom->Is3D() ? 3 : 2);
+    try {
+      flat->offsets.push_back(0);
+      flat->parts.push_back(0);
+      addGeometry(*flat, gdal_geom);
+    } catch (const std::bad_alloc &) { throw "Out of memory exporting the coordinates"; }
+    return flat;
+  };
+
+  job.rval = [](std::shared_ptr<FlatCoordinates> flat, const GetFromPersistentFunc &) {
+    Nan::EscapableHandleScope scope;
+    v8::Isolate *isolate = v8::Isolate::GetCurrent();
+
+    Local<ArrayBuffer> coords_buffer = ArrayBuffer::New(isolate, flat->coordinates.size() * sizeof(double));
+    Local<Float64Array> coordinates = Float64Array::New(coords_buffer, 0, flat->coordinates.size());
+    if (!flat->coordinates.empty()) {
+      Nan::TypedArrayContents<double> contents(coordinates);
+      memcpy(*contents, flat->coordinates.data(), flat->coordinates.size() * sizeof(double));
+    }
+
+    Local<ArrayBuffer> offsets_buffer = ArrayBuffer::New(isolate, flat->offsets.size() * sizeof(uint32_t));
+    Local<Uint32Array> offsets = Uint32Array::New(offsets_buffer, 0, flat->offsets.size());
+    Nan::TypedArrayContents<uint32_t> offsets_contents(offsets);
+    memcpy(*offsets_contents, flat->offsets.data(), flat->offsets.size() * sizeof(uint32_t));
+
+    Local<ArrayBuffer> parts_buffer = ArrayBuffer::New(isolate, flat->parts.size() * sizeof(uint32_t));
+    Local<Uint32Array> parts = Uint32Array::New(parts_buffer, 0, flat->parts.size());
+    Nan::TypedArrayContents<uint32_t> parts_contents(parts);
+    memcpy(*parts_contents, flat->parts.data(), flat->parts.size() * sizeof(uint32_t));
+
+    Local<Object> result = Nan::New<Object>();
+    Nan::Set(result, Nan::New("dims").ToLocalChecked(), Nan::New<Integer>(flat->dims));
+    Nan::Set(result, Nan::New("coordinates").ToLocalChecked(), coordinates);
+    Nan::Set(result, Nan::New("offsets").ToLocalChecked(), offsets);
+    Nan::Set(result, Nan::New("parts").ToLocalChecked(), parts);
+    return scope.Escape(result.As<Value>());
+  };
+  job.run(info, async, 1);
+}
+
 /**
  * Convert geometry to strictly 2D.
  *
@@ -1642,6 +1843,246 @@ GDAL_ASYNCABLE_DEFINE(Geometry::createFromWkb) {
   job.run(info, async, 2);
 }
 
+// Fills a line or a ring with the vertices [begin, end) of flat interleaved coordinates
+static void setFlatPoints(OGRSimpleCurve *curve, const double *coords, int dims, uint32_t begin, uint32_t end) {
+  int n = static_cast<int>(end - begin);
+  if (dims == 2) {
+    // OGRRawPoint is a pair of doubles, 2D coordinates can be used without copying
+    curve->setPoints(n, reinterpret_cast<const OGRRawPoint *>(coords + begin * 2));
+    return;
+  }
+  std::vector<double> x(n), y(n), z(n);
+  const double *p = coords + begin * 3;
+  for (int i = 0; i < n; i++) {
+    x[i] = p[i * 3];
+    y[i] = p[i * 3 + 1];
+    z[i] = p[i * 3 + 2];
+  }
+  curve->setPoints(n, x.data(), y.data(), z.data());
+}
+
+static OGRPolygon *
+flatPolygon(const double *coords, int dims, const std::vector<uint32_t> &offsets, uint32_t first, uint32_t last) {
+  OGRPolygon *poly = new OGRPolygon();
+  for (uint32_t r = first; r < last; r++) {
+    OGRLinearRing *ring = new OGRLinearRing();
+    setFlatPoints(ring, coords, dims, offsets[r], offsets[r + 1]);
+    poly->addRingDirectly(ring);
+  }
+  return poly;
+}
+
+/**
+ * @typedef {object} GeometryFromCoordinatesOptions
+ * @property {Uint32Array} [parts]
+ * @property {number} [dims]
+ */
+
+/**
+ * Creates a Geometry from flat interleaved coordinates in a single operation,
+ * this is the inverse of `Geometry.getCoordinates()`.
+ *
+ * `offsets` contains the index of the first vertex of each ring or line followed
+ * by the total number of vertices, by default all the vertices form a single ring.
+ * `options.parts` contains the index of the first ring of each polygon of a `MultiPolygon`
+ * followed by the total number of rings, by default every ring is a separate polygon.
+ *
+ * Supported types are `Point`, `LineString`, `Polygon`, `MultiPoint`,
+ * `MultiLineString` and `MultiPolygon`.
+ *
+ * @example
+ *
+ * const track = gdal.Geometry.fromCoordinates(gdal.wkbLineString, coordinates);
+ *
+ * const { coordinates, offsets, parts, dims } = multiPolygon.getCoordinates();
+ * const copy = gdal.Geometry.fromCoordinates(gdal.wkbMultiPolygon, coordinates, offsets, { parts, dims });
+ *
+ * @static
+ * @method fromCoordinates
+ * @instance
+ * @memberof Geometry
+ * @throws {Error}
+ * @param {number} type WKB geometry type
+ * @param {Float64Array} coordinates
+ * @param {Uint32Array} [offsets]
+ * @param {GeometryFromCoordinatesOptions} [options]
+ * @param {Uint32Array} [options.parts]
+ * @param {number} [options.dims] `2` or `3`, defaults to `3` for types with Z coordinates
+ * @return {Geometry}
+ */
+
+/**
+ * Creates a Geometry from flat interleaved coordinates in a single operation,
+ * this is the inverse of `Geometry.getCoordinates()`.
+ * @async
+ *
+ * See `fromCoordinates()` for the layout of the data.
+ * The arrays must not be modified until the operation has completed.
+ *
+ * @static
+ * @method fromCoordinatesAsync
+ * @instance
+ * @memberof Geometry
+ * @throws {Error}
+ * @param {number} type WKB geometry type
+ * @param {Float64Array} coordinates
+ * @param {Uint32Array} [offsets]
+ * @param {GeometryFromCoordinatesOptions} [options]
+ * @param {Uint32Array} [options.parts]
+ * @param {number} [options.dims] `2` or `3`, defaults to `3` for types with Z coordinates
+ * @param {callback<Geometry>} [callback=undefined]
+ * @return {Promise<Geometry>}
+ */
+GDAL_ASYNCABLE_DEFINE(Geometry::createFromCoordinates) {
+  int type_arg;
+  Local<Object> options;
+  NODE_ARG_INT(0, "type", type_arg);
+  if (info.Length() < 2 || !info[1]->IsFloat64Array()) {
+    Nan::ThrowTypeError("coordinates must be a Float64Array");
+    return;
+  }
+  NODE_ARG_OBJECT_OPT(3, "options", options);
+
+  OGRwkbGeometryType type = static_cast<OGRwkbGeometryType>(type_arg);
+  int dims = OGR_GT_HasZ(type) ? 3 : 2;
+  Local<Value> parts_val = Nan::Undefined();
+  if (!options.IsEmpty()) {
+    NODE_INT_FROM_OBJ_OPT(options, "dims", dims);
+    parts_val = Nan::Get(options, Nan::New("parts").ToLocalChecked()).ToLocalChecked();
+  }
+  if (dims != 2 && dims != 3) {
+    Nan::ThrowRangeError("dims must be 2 or 3");
+    return;
+  }
+  type = OGR_GT_Flatten(type);
+  if (
+    type != wkbPoint && type != wkbLineString && type != wkbPolygon && type != wkbMultiPoint &&
+    type != wkbMultiLineString && type != wkbMultiPolygon) {
+    Nan::ThrowError("Unsupported geometry type");
+    return;
+  }
+
+  Nan::TypedArrayContents<double> coords_contents(info[1]);
+  const double *coords = *coords_contents;
+  if (coords_contents.length() % dims != 0) {
+    Nan::ThrowRangeError("The length of coordinates must be a multiple of dims");
+    return;
+  }
+  size_t vertices = coords_contents.length() / dims;
+  if (vertices > UINT32_MAX) {
+    Nan::ThrowRangeError("Too many vertices");
+    return;
+  }
+
+  std::shared_ptr<std::vector<uint32_t>> offsets = std::make_shared<std::vector<uint32_t>>();
+  if (info.Length() > 2 && !info[2]->IsUndefined() && !info[2]->IsNull()) {
+    if (!info[2]->IsUint32Array()) {
+      Nan::ThrowTypeError("offsets must be an Uint32Array");
+      return;
+    }
+    Nan::TypedArrayContents<uint32_t> contents(info[2]);
+    offsets->assign(*contents, *contents + contents.length());
+  } else {
+    offsets->assign({0, static_cast<uint32_t>(vertices)});
+  }
+  if (offsets->size() < 1) {
+    Nan::ThrowRangeError("offsets must contain at least one element");
+    return;
+  }
+  for (size_t i = 0; i < offsets->size(); i++) {
+    if ((*offsets)[i] > vertices || (i > 0 && (*offsets)[i] < (*offsets)[i - 1])) {
+      Nan::ThrowRangeError("Invalid ring offsets");
+      return;
+    }
+  }
+  uint32_t rings = static_cast<uint32_t>(offsets->size() - 1);
+
+  std::shared_ptr<std::vector<uint32_t>> parts = std::make_shared<std::vector<uint32_t>>();
+  if (!parts_val->IsUndefined() && !parts_val->IsNull()) {
+    if (!parts_val->IsUint32Array()) {
+      Nan::ThrowTypeError("parts must be an Uint32Array");
+      return;
+    }
+    Nan::TypedArrayContents<uint32_t> contents(parts_val);
+    parts->assign(*contents, *contents + contents.length());
+    for (size_t i = 0; i < parts->size(); i++) {
+      if ((*parts)[i] > rings || (i > 0 && (*parts)[i] < (*parts)[i - 1])) {
+        Nan::ThrowRangeError("Invalid part offsets");
+        return;
+      }
+    }
+  } else {
+    for (uint32_t r = 0; r <= rings; r++) parts->push_back(r);
+  }
+
+  if (type == wkbPoint && vertices > 1) {
+    Nan::ThrowRangeError("A Point must have at most one vertex");
+    return;
+  }
+  if (type == wkbLineString && rings != 1) {
+    Nan::ThrowRangeError("A LineString must have exactly one ring");
+    return;
+  }
+
+  GDALAsyncableJob<OGRGeometry *> job(0);
+  job.persist("coordinates", info[1].As<Object>());
+  job.main = [type, coords, dims, vertices, offsets, parts, rings](const GDALExecutionProgress &) {
+    OGRGeometry *geom = nullptr;
+    switch (type) {
+      case wkbPoint: {
+        OGRPoint *pt = new OGRPoint();
+        if (vertices > 0) {
+          pt->setX(coords[0]);
+          pt->setY(coords[1]);
+          if (dims == 3) pt->setZ(coords[2]);
+        } else if (dims == 3) {
+          pt->set3D(TRUE);
+        }
+        geom = pt;
+        break;
+      }
+      case wkbLineString: {
+        OGRLineString *line = new OGRLineString();
+        setFlatPoints(line, coords, dims, (*offsets)[0], (*offsets)[1]);
+        geom = line;
+        break;
+      }
+      case wkbPolygon: geom = flatPolygon(coords, dims, *offsets, 0, rings); break;
+      case wkbMultiPoint: {
+        OGRMultiPoint *multi = new OGRMultiPoint();
+        for (size_t i = 0; i < vertices; i++) {
+          const double *p = coords + i * dims;
+          multi->addGeometryDirectly(dims == 3 ? new OGRPoint(p[0], p[1], p[2]) : new OGRPoint(p[0], p[1]));
+        }
+        geom = multi;
+        break;
+      }
+      case wkbMultiLineString: {
+        OGRMultiLineString *multi = new OGRMultiLineString();
+        for (uint32_t r = 0; r < rings; r++) {
+          OGRLineString *line = new OGRLineString();
+          setFlatPoints(line, coords, dims, (*offsets)[r], (*offsets)[r + 1]);
+          multi->addGeometryDirectly(line);
+        }
+        geom = multi;
+        break;
+      }
+      case wkbMultiPolygon: {
+        OGRMultiPolygon *multi = new OGRMultiPolygon();
+        for (size_t p = 0; p + 1 < parts->size(); p++)
+          multi->addGeometryDirectly(flatPolygon(coords, dims, *offsets, (*parts)[p], (*parts)[p + 1]));
+        geom = multi;
+        break;
+      }
+      default: throw "Unsupported geometry type";
+    }
+    if (dims == 3) geom->set3D(TRUE);
+    return geom;
+  };
+  job.rval = [](OGRGeometry *geom, const GetFromPersistentFunc &) { return Geometry::New(geom, true); };
+  job.run(info, async, 4);
+}
+
 /**
  * Creates a Geometry from a GeoJSON object fragment.
  * The async version depends on V8 for object serialization and this part is not parallelizable.
@@ -66,6 +66,7 @@ class Geometry : public GeometryBase<Geometry, OGRGeometry> {
   static NAN_METHOD(getNumGeometries);
   GDAL_ASYNCABLE_DECLARE(getEnvelope);
   GDAL_ASYNCABLE_DECLARE(getEnvelope3D);
+  GDAL_ASYNCABLE_DECLARE(getCoordinates);
   GDAL_ASYNCABLE_DECLARE(flattenTo2D);
   GDAL_ASYNCABLE_DECLARE(transform);
   GDAL_ASYNCABLE_DECLARE(transformTo);
@@ -79,6 +80,7 @@ class Geometry : public GeometryBase<Geometry, OGRGeometry> {
   GDAL_ASYNCABLE_DECLARE(createFromWkb);
   GDAL_ASYNCABLE_DECLARE(createFromGeoJson);
   GDAL_ASYNCABLE_DECLARE(createFromGeoJsonBuffer);
+  GDAL_ASYNCABLE_DECLARE(createFromCoordinates);
   static NAN_METHOD(getName);
   static NAN_METHOD(getConstructor);
 
@@ -29,6 +29,7 @@
 #include "geometry/gdal_geometry.hpp"
 #include "geometry/gdal_geometrycollection.hpp"
 #include "gdal_layer.hpp"
+#include "gdal_arrow_stream.hpp"
 #include "geometry/gdal_simplecurve.hpp"
 #include "geometry/gdal_linearring.hpp"
 #include "geometry/gdal_linestring.hpp"
@@ -45,6 +46,7 @@
 #include "gdal_fs.hpp"
 
 #include "utils/field_types.hpp"
+#include "utils/srs_cache.hpp"
 
 // collections
 #include "collections/dataset_bands.hpp"
@@ -80,6 +82,7 @@ using namespace v8;
 
 FILE *log_file = NULL;
 ObjectStore object_store;
+SRSCache srs_cache;
 bool eventLoopWarn = true;
 
 static NAN_GETTER(LastErrorGetter) {
@@ -119,6 +122,81 @@ static NAN_SETTER(EventLoopWarningSetter) {
   eventLoopWarn = Nan::To<bool>(value).ToChecked();
 }
 
+static NAN_GETTER(ThreadPoolSizeGetter) {
+  info.GetReturnValue().Set(Nan::New<Integer>(async_thread_pool.getSize()));
+}
+
+static NAN_SETTER(ThreadPoolSizeSetter) {
+  if (!value->IsUint32()) {
+    Nan::ThrowError("'threadPoolSize' must be a positive integer or 0");
+    return;
+  }
+  async_thread_pool.setSize(Nan::To<uint32_t>(value).ToChecked());
+}
+
+static NAN_GETTER(SRSCacheSizeGetter) {
+  info.GetReturnValue().Set(Nan::New<Number>(static_cast<double>(srs_cache.getCapacity())));
+}
+
+static NAN_SETTER(SRSCacheSizeSetter) {
+  if (!value->IsUint32()) {
+    Nan::ThrowError("'srsCacheSize' must be a positive integer or 0");
+    return;
+  }
+  srs_cache.setCapacity(Nan::To<uint32_t>(value).ToChecked());
+}
+
+static Local<Object> SRSCacheStatsToJS(const SRSCacheStats &stats) {
+  Nan::EscapableHandleScope scope;
+  Local<Object> result = Nan::New<Object>();
+  Nan::Set(result, Nan::New("hits").ToLocalChecked(), Nan::New<Number>(static_cast<double>(stats.hits)));
+  Nan::Set(result, Nan::New("misses").ToLocalChecked(), Nan::New<Number>(static_cast<double>(stats.misses)));
+  Nan::Set(result, Nan::New("size").ToLocalChecked(), Nan::New<Number>(static_cast<double>(stats.size)));
+  return scope.Escape(result);
+}
+
+/**
+ * @typedef {object} SRSCacheStats
+ * @property {number} hits
+ * @property {number} misses
+ * @property {number} size Number of objects in the cache
+ */
+
+/**
+ * @typedef {object} SRSCacheInfo
+ * @property {SRSCacheStats} srs Spatial references created by `fromEPSG()`, `fromEPSGA()` and `fromUserInput()`
+ * @property {SRSCacheStats} transformations Coordinate transformations between two spatial references
+ */
+
+/**
+ * Returns the statistics of the process-wide cache of spatial references
+ * and coordinate transformations, see {@link srsCacheSize}
+ *
+ * @static
+ * @method getSRSCacheStats
+ * @return {SRSCacheInfo}
+ */
+static NAN_METHOD(getSRSCacheStats) {
+  Local<Object> result = Nan::New<Object>();
+  Nan::Set(result, Nan::New("srs").ToLocalChecked(), SRSCacheStatsToJS(srs_cache.srsStats()));
+  Nan::Set(result, Nan::New("transformations").ToLocalChecked(), SRSCacheStatsToJS(srs_cache.transformationStats()));
+  info.GetReturnValue().Set(result);
+}
+
+/**
+ * Empties the process-wide cache of spatial references and coordinate
+ * transformations and resets its statistics, it should be called
+ * after changing the PROJ search paths or configuration options that affect
+ * the resolution of the coordinate systems
+ *
+ * @static
+ * @method clearSRSCache
+ * @return {void}
+ */
+static NAN_METHOD(clearSRSCache) {
+  srs_cache.clear();
+}
+
 extern "C" {
 
 static NAN_METHOD(QuietOutput) {
@@ -193,6 +271,42 @@ static NAN_METHOD(Log) {
   return;
 }
 
+struct OpenedDataset {
+  GDALDataset *ds;
+  std::vector<GDALDataset *> readers;
+};
+
+// The default number of handles of a Dataset opened for parallel reading
+// Every handle has its own file descriptors and block cache entries, so it
+// does not grow with the number of cores, use openPool() for more
+static const int defaultPoolSize = 4;
+
+// Open the main handle and the additional reader handles (runs in the async context)
+static OpenedDataset openWithReaders(const std::string &path, unsigned int flags, int readers) {
+  OpenedDataset r;
+  r.ds = (GDALDataset *)GDALOpenEx(path.c_str(), flags, NULL, NULL, NULL);
+  if (!r.ds) throw CPLGetLastErrorMsg();
+  for (int i = 0; i < readers; i++) {
+    GDALDataset *reader = (GDALDataset *)GDALOpenEx(path.c_str(), flags, NULL, NULL, NULL);
+    if (!reader) {
+      for (GDALDataset *opened : r.readers) GDALClose(opened);
+      GDALClose(r.ds);
+      throw CPLGetLastErrorMsg();
+    }
+    r.readers.push_back(reader);
+  }
+  return r;
+}
+
+static Local<Value> newDatasetWithReaders(const OpenedDataset &r) {
+  Local<Value> ds = Dataset::New(r.ds);
+  if (!r.readers.empty()) {
+    Dataset *wrapped = Nan::ObjectWrap::Unwrap<Dataset>(ds.As<Object>());
+    object_store.addReaders(wrapped->uid, r.readers);
+  }
+  return ds;
+}
+
 /*
  * Common code for sync and async opening.
  */
@@ -206,6 +320,7 @@ GDAL_ASYNCABLE_DEFINE(gdal_open) {
   NODE_ARG_OPT_STR(1, "mode", mode);
 
   unsigned int flags = 0;
+  int readers = 0;
   for (unsigned i = 0; i < mode.length(); i++) {
     if (mode[i] == 'r') {
       if (i < mode.length() - 1 && mode[i + 1] == '+') {
@@ -218,20 +333,94 @@ GDAL_ASYNCABLE_DEFINE(gdal_open) {
     } else if (mode[i] == 'm') {
       flags |= GDAL_OF_MULTIDIM_RASTER;
 #endif
+    } else if (mode[i] == 'p') {
+      readers = defaultPoolSize - 1;
     } else {
-      Nan::ThrowError("Invalid open mode. Must contain only \"r\" or \"r+\" and \"m\" ");
+      Nan::ThrowError("Invalid open mode. Must contain only \"r\" or \"r+\", \"m\" and \"p\" ");
       return;
     }
   }
+  if (readers > 0 && (flags & GDAL_OF_UPDATE)) {
+    Nan::ThrowError("Parallel reading (\"p\") is supported only in read-only mode");
+    return;
+  }
   flags |= GDAL_OF_VERBOSE_ERROR;
 
-  GDALAsyncableJob<GDALDataset *> job(0);
-  job.rval = [](GDALDataset *ds, const GetFromPersistentFunc &) { return Dataset::New(ds); };
-  job.main = [path, flags](const GDALExecutionProgress &) {
-    GDALDataset *ds = (GDALDataset *)GDALOpenEx(path.c_str(), flags, NULL, NULL, NULL);
-    if (!ds) throw CPLGetLastErrorMsg();
-    return ds;
-  };
+  GDALAsyncableJob<OpenedDataset> job(0);
+  job.rval = [](OpenedDataset r, const GetFromPersistentFunc &) { return newDatasetWithReaders(r); };
+  job.main = [path, flags, readers](const GDALExecutionProgress &) { return openWithReaders(path, flags, readers); };
+  job.run(info, async, 2);
+}
+
+/**
+ * @typedef {object} OpenPoolOptions
+ * @property {number} [size]
+ */
+
+/**
+ * Opens a read-only dataset with a pool of several GDAL handles on the same file.
+ *
+ * The returned `Dataset` is a normal `Dataset`, but these asynchronous operations
+ * can run in parallel - one per handle:
+ * - `Dataset.readAsync()` and the `rasterSizeAsync`, `srsAsync` and `geoTransformAsync` getters
+ * - `pixels.getAsync()`, `pixels.readAsync()`, `pixels.readBlockAsync()`, `pixels.readMultiAsync()`,
+ *   `pixels.sampleAsync()` and `pixels.readBlockRefAsync()` on its bands
+ * - the `sizeAsync`, `blockSizeAsync`, `dataTypeAsync`, `noDataValueAsync`, `offsetAsync`,
+ *   `scaleAsync` and `unitTypeAsync` getters of its bands
+ *
+ * Overviews and masks and all other operations use the main handle.
+ * The georeferencing and the band metadata listed above cannot be modified.
+ *
+ * This is equivalent to opening with the `"rp"` mode with an explicit pool size.
+ *
+ * @example
+ *
+ * const ds = gdal.openPool('tiles.tif', { size: 8 });
+ * const tiles = await Promise.all(requests.map((r) =>
+ *   ds.bands.get(1).pixels.readAsync(r.x, r.y, 256, 256)));
+ *
+ * @throws {Error}
+ * @static
+ * @method openPool
+ * @param {string} path Path to dataset
+ * @param {OpenPoolOptions} [options]
+ * @param {number} [options.size=4] Total number of GDAL handles
+ * @return {Dataset}
+ */
+
+/**
+ * Opens a read-only dataset with a pool of several GDAL handles on the same file.
+ * @async
+ *
+ * @static
+ * @method openPoolAsync
+ * @param {string} path Path to dataset
+ * @param {OpenPoolOptions} [options]
+ * @param {number} [options.size=4] Total number of GDAL handles
+ * @param {callback<Dataset>} [callback=undefined]
+ * @return {Promise<Dataset>}
+ */
+GDAL_ASYNCABLE_GLOBAL(gdal_open_pool);
+GDAL_ASYNCABLE_DEFINE(gdal_open_pool) {
+
+  std::string path;
+  Local<Object> options;
+  int size = defaultPoolSize;
+
+  NODE_ARG_STR(0, "path", path);
+  NODE_ARG_OBJECT_OPT(1, "options", options);
+  if (!options.IsEmpty()) NODE_INT_FROM_OBJ_OPT(options, "size", size);
+  if (size < 1) {
+    Nan::ThrowRangeError("Pool size must be at least 1");
+    return;
+  }
+
+  unsigned int flags = GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR;
+  int readers = size - 1;
+
+  GDALAsyncableJob<OpenedDataset> job(0);
+  job.rval = [](OpenedDataset r, const GetFromPersistentFunc &) { return newDatasetWithReaders(r); };
+  job.main = [path, flags, readers](const GDALExecutionProgress &) { return openWithReaders(path, flags, readers); };
   job.run(info, async, 2);
 }
 
@@ -315,6 +504,7 @@ static NAN_METHOD(setPROJSearchPath) {
   const char *const paths[] = {path.c_str(), nullptr};
   OSRSetPROJSearchPaths(paths);
 #endif
+  srs_cache.clear();
 }
 
 static NAN_METHOD(ThrowDummyCPLError) {
@@ -322,6 +512,10 @@ static NAN_METHOD(ThrowDummyCPLError) {
   return;
 }
 
+static NAN_METHOD(threadPoolThreads) {
+  info.GetReturnValue().Set(Nan::New<Integer>(async_thread_pool.getThreads()));
+}
+
 static NAN_METHOD(isAlive) {
 
   long uid;
@@ -331,7 +525,9 @@ static NAN_METHOD(isAlive) {
 }
 
 void Cleanup(void *) {
+  async_thread_pool.shutdown();
   object_store.cleanup();
+  srs_cache.clear();
 }
 
 static void Init(Local<Object> target, Local<v8::Value>, void *) {
@@ -344,12 +540,16 @@ static void Init(Local<Object> target, Local<v8::Value>, void *) {
   mainV8ThreadId = std::this_thread::get_id();
 
   Nan__SetAsyncableMethod(target, "open", gdal_open);
+  Nan__SetAsyncableMethod(target, "openPool", gdal_open_pool);
   Nan::SetMethod(target, "setConfigOption", setConfigOption);
   Nan::SetMethod(target, "getConfigOption", getConfigOption);
   Nan::SetMethod(target, "decToDMS", decToDMS);
   Nan::SetMethod(target, "setPROJSearchPath", setPROJSearchPath);
+  Nan::SetMethod(target, "getSRSCacheStats", getSRSCacheStats);
+  Nan::SetMethod(target, "clearSRSCache", clearSRSCache);
   Nan::SetMethod(target, "_triggerCPLError", ThrowDummyCPLError); // for tests
   Nan::SetMethod(target, "_isAlive", isAlive);                    // for tests
+  Nan::SetMethod(target, "_threadPoolThreads", threadPoolThreads); // for tests
 
   Warper::Initialize(target);
   Algorithms::Initialize(target);
@@ -365,6 +565,9 @@ static void Init(Local<Object> target, Local<v8::Value>, void *) {
 #endif
 
   Layer::Initialize(target);
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+  ArrowStream::Initialize(target);
+#endif
   Feature::Initialize(target);
   FeatureDefn::Initialize(target);
   FieldDefn::Initialize(target);
@@ -1753,6 +1956,41 @@ static void Init(Local<Object> target, Local<v8::Value>, void *) {
   Nan::SetAccessor(
     target, Nan::New<v8::String>("eventLoopWarning").ToLocalChecked(), EventLoopWarningGetter, EventLoopWarningSetter);
 
+  /**
+   * Number of threads in the dedicated thread pool used for running
+   * the asynchronous GDAL operations, defaults to the number of CPU cores,
+   * threads are started on demand
+   *
+   * Setting it to 0 runs the asynchronous operations on the libuv thread pool
+   * which is shared with the Node.js `fs`, `dns` and `zlib` modules and whose
+   * size is controlled by `UV_THREADPOOL_SIZE`
+   *
+   * Use `(gdal as any).threadPoolSize = 8` to set the value from TypeScript
+   *
+   * @var {number} threadPoolSize
+   */
+  Nan::SetAccessor(
+    target, Nan::New<v8::String>("threadPoolSize").ToLocalChecked(), ThreadPoolSizeGetter, ThreadPoolSizeSetter);
+
+  /**
+   * Maximum number of spatial references and of coordinate transformations
+   * kept in the process-wide LRU cache, defaults to 128
+   *
+   * Creating a spatial reference from an EPSG code or from an user input
+   * string and creating a coordinate transformation between two spatial
+   * references involve PROJ database lookups, the cache allows to skip them
+   * when the same objects are created again. The returned objects are always
+   * independent copies.
+   *
+   * Setting it to 0 disables the cache
+   *
+   * Use `(gdal as any).srsCacheSize = 1024` to set the value from TypeScript
+   *
+   * @var {number} srsCacheSize
+   */
+  Nan::SetAccessor(
+    target, Nan::New<v8::String>("srsCacheSize").ToLocalChecked(), SRSCacheSizeGetter, SRSCacheSizeSetter);
+
   // Local<Object> versions = Nan::New<Object>();
   // Nan::Set(versions, Nan::New("node").ToLocalChecked(),
   // Nan::New(NODE_VERSION+1)); Nan::Set(versions,
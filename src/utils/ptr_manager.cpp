@@ -7,6 +7,7 @@
 #include "../gdal_layer.hpp"
 #include "../gdal_rasterband.hpp"
 
+#include <cstring>
 #include <sstream>
 #include <thread>
 
@@ -55,6 +56,8 @@
 // * All GDAL operations on a dependant object require locking the parent dataset
 // - This is best accomplished though .lockDataset
 // * Dependant Datasets share a semaphore with their parent through a shared_ptr
+// * Datasets opened for parallel reading have additional read-only handles,
+//   each one with its own semaphore, read-only jobs can use any of them
 
 namespace node_gdal {
 
@@ -138,6 +141,30 @@ AsyncLock ObjectStore::lockDataset(long uid) {
   }
 }
 
+/*
+ * Lock any of the handles of a Dataset for a read-only operation, same semantics as the previous one.
+ * The reader handles are preferred, so that the main handle remains available.
+ * reader is set to the reader handle or to nullptr when the main handle was locked.
+ */
+AsyncLock ObjectStore::lockDatasetReader(long uid, GDALDataset *&reader) {
+  reader = nullptr;
+  if (uid == 0) return nullptr;
+  uv_scoped_mutex lock(&master_lock);
+  while (true) {
+    auto parent = uidMap<GDALDataset *>.find(uid);
+    if (parent == uidMap<GDALDataset *>.end()) { throw "Parent Dataset object has already been destroyed"; }
+    for (const DatasetReader &r : parent->second->readers) {
+      if (uv_sem_trywait(r.async_lock.get()) == 0) {
+        reader = r.ptr;
+        return r.async_lock;
+      }
+    }
+    int r = uv_sem_trywait(parent->second->async_lock.get());
+    if (r == 0) { return parent->second->async_lock; }
+    uv_cond_wait(&master_sleep, &master_lock);
+  }
+}
+
 /*
  * Lock several Datasets by uid avoiding deadlocks, same semantics as the previous one.
  */
@@ -256,9 +283,139 @@ long ObjectStore::add(GDALDataset *ptr, Nan::Persistent<Object> &obj, long paren
   } else {
     uidMap<GDALDataset *>[uid] -> async_lock = uidMap<GDALDataset *>[parent_uid] -> async_lock;
   }
+  uidMap<GDALDataset *>[uid] -> resources = make_shared<DatasetResources>();
   return uid;
 }
 
+// Attach additional read-only handles to a Dataset, the ObjectStore becomes their owner
+void ObjectStore::addReaders(long uid, const vector<GDALDataset *> &readers) {
+  uv_scoped_mutex lock(&master_lock);
+  auto item = uidMap<GDALDataset *>[uid];
+  for (GDALDataset *ptr : readers) {
+    DatasetReader r{ptr, shared_ptr<uv_sem_t>(new uv_sem_t(), uv_sem_deleter())};
+    uv_sem_init(r.async_lock.get(), 1);
+    item->readers.push_back(r);
+  }
+}
+
+DatasetResources::DatasetResources() : closed(false) {
+  uv_mutex_init(&lock);
+}
+
+DatasetResources::~DatasetResources() {
+  uv_mutex_destroy(&lock);
+}
+
+// Retrieved on the main thread before launching a job that will register resources
+shared_ptr<DatasetResources> ObjectStore::getResources(long uid) {
+  uv_scoped_mutex lock(&master_lock);
+  auto item = uidMap<GDALDataset *>.find(uid);
+  if (item == uidMap<GDALDataset *>.end()) { throw "Parent Dataset object has already been destroyed"; }
+  return item->second->resources;
+}
+
+// Called with the Dataset locked, so it cannot be closed in the meantime
+// (the master lock cannot be acquired here)
+void ObjectStore::pinBlock(const shared_ptr<PinnedBlock> &pin) {
+  shared_ptr<DatasetResources> resources = pin->resources.lock();
+  if (resources != nullptr) {
+    uv_scoped_mutex lock(&resources->lock);
+    if (!resources->closed) {
+      resources->pinned.push_back(pin);
+      return;
+    }
+  }
+  pin->block->DropLock();
+  pin->released = true;
+  throw "Parent Dataset object has already been destroyed";
+}
+
+// Called when the JS ArrayBuffer has been garbage collected
+// (main thread only, this can happen while releasing the blocks of a Dataset)
+void ObjectStore::unpinBlock(const shared_ptr<PinnedBlock> &pin) {
+  if (pin->released) return;
+  pin->block->DropLock();
+  pin->released = true;
+  shared_ptr<DatasetResources> resources = pin->resources.lock();
+  if (resources != nullptr) {
+    uv_scoped_mutex lock(&resources->lock);
+    resources->pinned.remove(pin);
+  }
+}
+
+// Called with the Dataset locked before flushing its block cache
+// GDAL cannot flush a locked block, it would remove it from the band
+// without freeing it and the band could then be destroyed under it
+void ObjectStore::checkNotPinned(const shared_ptr<DatasetResources> &resources) {
+  uv_scoped_mutex lock(&resources->lock);
+  if (!resources->pinned.empty()) throw "Cannot flush a Dataset with blocks returned by readBlockRef()";
+}
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+ArrowStreamHandle::ArrowStreamHandle() : released(false) {
+  memset(&stream, 0, sizeof(stream));
+}
+
+void ArrowStreamHandle::release() {
+  if (released) return;
+  if (stream.release != nullptr) stream.release(&stream);
+  released = true;
+}
+
+// Called with the Dataset locked after creating the stream
+void ObjectStore::addArrowStream(
+  const shared_ptr<DatasetResources> &resources, const shared_ptr<ArrowStreamHandle> &handle) {
+  uv_scoped_mutex lock(&resources->lock);
+  if (resources->closed) {
+    handle->release();
+    throw "Parent Dataset object has already been destroyed";
+  }
+  resources->arrow_streams.push_back(handle);
+}
+
+// Called with the Dataset locked
+void ObjectStore::releaseArrowStream(
+  const shared_ptr<DatasetResources> &resources, const shared_ptr<ArrowStreamHandle> &handle) {
+  uv_scoped_mutex lock(&resources->lock);
+  handle->release();
+  resources->arrow_streams.remove(handle);
+}
+#endif
+
+// The blocks must be unlocked before closing their Dataset and the JS arrays
+// that point to them must not be able to access this memory anymore,
+// the Arrow streams must be released before closing their Layer
+static void releaseResources(const shared_ptr<DatasetResources> &resources, bool detach) {
+  uv_scoped_mutex lock(&resources->lock);
+  resources->closed = true;
+  for (const shared_ptr<PinnedBlock> &pin : resources->pinned) {
+    pin->released = true;
+    pin->block->DropLock();
+    if (detach && !pin->array_buffer.IsEmpty()) {
+      Nan::HandleScope scope;
+      Local<ArrayBuffer> ab = pin->array_buffer.Get(v8::Isolate::GetCurrent());
+#if V8_MAJOR_VERSION > 10 || (V8_MAJOR_VERSION == 10 && V8_MINOR_VERSION >= 9)
+      ab->Detach(Local<Value>()).IsNothing();
+#else
+      ab->Detach();
+#endif
+    }
+    pin->array_buffer.Reset();
+  }
+  resources->pinned.clear();
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+  for (const shared_ptr<ArrowStreamHandle> &handle : resources->arrow_streams) handle->release();
+  resources->arrow_streams.clear();
+#endif
+}
+
+size_t ObjectStore::readerCount(long uid) {
+  uv_scoped_mutex lock(&master_lock);
+  auto item = uidMap<GDALDataset *>.find(uid);
+  if (item == uidMap<GDALDataset *>.end()) return 0;
+  return item->second->readers.size();
+}
+
 template <typename GDALPTR> bool ObjectStore::has(GDALPTR ptr) {
   uv_scoped_mutex lock(&master_lock);
   return ptrMap<GDALPTR>.count(ptr) > 0;
@@ -324,12 +481,15 @@ static inline void uv_sem_wait_with_warning(uv_sem_t *sem, const char *warning)
 
 // Disposing a Dataset is a special case - it has children (called with the master lock held)
 template <> void ObjectStore::dispose(shared_ptr<ObjectStoreItem<GDALDataset *>> item, bool manual) {
-  uv_sem_wait_with_warning(
-    item->async_lock.get(), manual ? (eventLoopWarn ? warningManualClose : nullptr) : warningGCBug);
+  const char *warning = manual ? (eventLoopWarn ? warningManualClose : nullptr) : warningGCBug;
+  uv_sem_wait_with_warning(item->async_lock.get(), warning);
+  // Jobs running on a reader handle can still access the main handle
+  for (const DatasetReader &r : item->readers) uv_sem_wait_with_warning(r.async_lock.get(), warning);
   uidMap<GDALDataset *>.erase(item->uid);
   ptrMap<GDALDataset *>.erase(item->ptr);
   if (item->parent != nullptr) item->parent->children.remove(item->uid);
 
+  for (const DatasetReader &r : item->readers) uv_sem_post(r.async_lock.get());
   uv_sem_post(item->async_lock.get());
   uv_cond_broadcast(&master_sleep);
   // Beyond this point the Dataset is not alive anymore ->
@@ -341,11 +501,19 @@ template <> void ObjectStore::dispose(shared_ptr<ObjectStoreItem<GDALDataset *>>
   // When this happens, they will skip this in do_dispose
   while (!item->children.empty()) { do_dispose(item->children.back()); }
 
+  releaseResources(item->resources, true);
+
   if (item->ptr) {
     LOG("Closing GDALDataset %ld [%p]", item->uid, item->ptr);
     GDALClose(item->ptr);
     item->ptr = nullptr;
   }
+
+  for (const DatasetReader &r : item->readers) {
+    LOG("Closing GDALDataset reader %ld [%p]", item->uid, r.ptr);
+    GDALClose(r.ptr);
+  }
+  item->readers.clear();
 }
 
 const char warningSQL[] =
@@ -414,6 +582,8 @@ void ObjectStore::do_dispose(long uid, bool manual) {
 // Closes still open Datasets on process exit
 // Called on the main thread after the event loop has exited
 void ObjectStore::cleanup() {
+  // The JS world is going away, there is no need to detach the arrays
+  for (auto const &item : uidMap<GDALDataset *>) releaseResources(item.second->resources, false);
   // This unusual loop is needed since dispose deletes elements from the map
   while (uidMap<GDALDataset *>.size() > 0) { dispose(uidMap<GDALDataset *>.cbegin()->second->uid, true); }
 }
@@ -13,7 +13,11 @@
 
 // ogr
 #include <ogrsf_frmts.h>
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+#include <ogr_recordbatch.h>
+#endif
 
+#include <atomic>
 #include <list>
 #include <map>
 
@@ -41,6 +45,58 @@ template <> struct ObjectStoreItem<OGRLayer *> {
   ObjectStoreItem(Nan::Persistent<Object> &obj);
 };
 
+// An additional read-only handle on the same Dataset with its own lock
+struct DatasetReader {
+  GDALDataset *ptr;
+  AsyncLock async_lock;
+};
+
+struct DatasetResources;
+
+// A block locked in the GDAL block cache and exposed to JS without copying
+// It remains locked until the JS ArrayBuffer is garbage collected or the Dataset is closed
+// Accessed only by the main thread once it has been created
+struct PinnedBlock {
+  GDALRasterBlock *block;
+  weak_ptr<DatasetResources> resources;
+  bool released;
+  v8::Global<v8::ArrayBuffer> array_buffer;
+};
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+// The description of a column of an Arrow stream, copied from its schema
+struct ArrowColumn {
+  std::string name;
+  std::string format;
+  bool dictionary;
+};
+
+// An Arrow C stream on a Layer, it is used only while holding the Dataset lock
+// It is released at the end of the stream, when it is closed or garbage collected
+// or when the Dataset is closed
+struct ArrowStreamHandle {
+  struct ArrowArrayStream stream;
+  vector<ArrowColumn> columns;
+  std::atomic<bool> released;
+  ArrowStreamHandle();
+  void release();
+};
+#endif
+
+// Objects that keep references inside a Dataset and must be released before closing it
+// They are registered by jobs holding the Dataset lock which cannot acquire the master lock,
+// so they have their own mutex
+struct DatasetResources {
+  uv_mutex_t lock;
+  bool closed;
+  list<shared_ptr<PinnedBlock>> pinned;
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+  list<shared_ptr<ArrowStreamHandle>> arrow_streams;
+#endif
+  DatasetResources();
+  ~DatasetResources();
+};
+
 template <> struct ObjectStoreItem<GDALDataset *> {
   long uid;
   Nan::Persistent<v8::Object> &obj;
@@ -48,6 +104,8 @@ template <> struct ObjectStoreItem<GDALDataset *> {
   shared_ptr<ObjectStoreItem<GDALDataset *>> parent;
   list<long> children;
   AsyncLock async_lock;
+  vector<DatasetReader> readers;
+  shared_ptr<DatasetResources> resources;
   ObjectStoreItem(Nan::Persistent<Object> &obj);
 };
 
@@ -60,6 +118,16 @@ class ObjectStore {
   template <typename GDALPTR> long add(GDALPTR ptr, Nan::Persistent<Object> &obj, long parent_uid);
   long add(OGRLayer *ptr, Nan::Persistent<Object> &obj, long parent_uid, bool is_result_set);
   long add(GDALDataset *ptr, Nan::Persistent<Object> &obj, long parent_uid);
+  void addReaders(long uid, const vector<GDALDataset *> &readers);
+  size_t readerCount(long uid);
+  shared_ptr<DatasetResources> getResources(long uid);
+  void pinBlock(const shared_ptr<PinnedBlock> &pin);
+  void unpinBlock(const shared_ptr<PinnedBlock> &pin);
+  void checkNotPinned(const shared_ptr<DatasetResources> &resources);
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 6)
+  void addArrowStream(const shared_ptr<DatasetResources> &resources, const shared_ptr<ArrowStreamHandle> &handle);
+  void releaseArrowStream(const shared_ptr<DatasetResources> &resources, const shared_ptr<ArrowStreamHandle> &handle);
+#endif
 
   void dispose(long uid, bool manual = false);
   bool isAlive(long uid);
@@ -80,6 +148,7 @@ class ObjectStore {
   }
   AsyncLock lockDataset(long uid);
   vector<AsyncLock> lockDatasets(vector<long> uids);
+  AsyncLock lockDatasetReader(long uid, GDALDataset *&reader);
   AsyncLock tryLockDataset(long uid);
   vector<AsyncLock> tryLockDatasets(vector<long> uids);
 
@@ -0,0 +1,153 @@
+#include "srs_cache.hpp"
+
+namespace node_gdal {
+
+template <typename T> LRUCache<T>::LRUCache(Deleter deleter) : hits(0), misses(0), items(), index(), deleter(deleter) {
+}
+
+template <typename T> LRUCache<T>::~LRUCache() {
+  clear();
+}
+
+template <typename T> T *LRUCache<T>::get(const std::string &key) {
+  auto it = index.find(key);
+  if (it == index.end()) {
+    misses++;
+    return nullptr;
+  }
+  hits++;
+  items.splice(items.begin(), items, it->second);
+  return it->second->second;
+}
+
+template <typename T> void LRUCache<T>::put(const std::string &key, T *obj, size_t capacity) {
+  auto it = index.find(key);
+  if (it != index.end()) {
+    // Another thread has created the same object in the meantime
+    deleter(obj);
+    return;
+  }
+  items.emplace_front(key, obj);
+  index[key] = items.begin();
+  trim(capacity);
+}
+
+template <typename T> void LRUCache<T>::trim(size_t capacity) {
+  while (items.size() > capacity) {
+    auto &last = items.back();
+    index.erase(last.first);
+    deleter(last.second);
+    items.pop_back();
+  }
+}
+
+template <typename T> void LRUCache<T>::clear() {
+  trim(0);
+  hits = 0;
+  misses = 0;
+}
+
+template class LRUCache<OGRSpatialReference>;
+template class LRUCache<OGRCoordinateTransformation>;
+
+SRSCache::SRSCache()
+  : lock(),
+    capacity(128),
+    srs(OGRSpatialReference::DestroySpatialReference),
+    transformations(OGRCoordinateTransformation::DestroyCT) {
+}
+
+OGRSpatialReference *SRSCache::getSRS(const std::string &key) {
+  std::lock_guard<std::mutex> guard(lock);
+  if (capacity == 0) return nullptr;
+  OGRSpatialReference *cached = srs.get(key);
+  if (cached == nullptr) return nullptr;
+  return cached->Clone();
+}
+
+void SRSCache::putSRS(const std::string &key, const OGRSpatialReference *obj) {
+  if (getCapacity() == 0) return;
+  OGRSpatialReference *copy = obj->Clone();
+  std::lock_guard<std::mutex> guard(lock);
+  srs.put(key, copy, capacity);
+}
+
+// The key includes the axis order of both spatial references as it changes the transformation
+std::string SRSCache::transformationKey(OGRSpatialReference *source, OGRSpatialReference *target) {
+  std::string key;
+  for (OGRSpatialReference *ref : {source, target}) {
+    char *wkt = nullptr;
+#if GDAL_VERSION_MAJOR >= 3
+    const char *options[] = {"FORMAT=WKT2_2018", nullptr};
+    OGRErr err = ref->exportToWkt(&wkt, options);
+#else
+    OGRErr err = ref->exportToWkt(&wkt);
+#endif
+    if (err != OGRERR_NONE || wkt == nullptr || *wkt == '\0') {
+      CPLFree(wkt);
+      return std::string();
+    }
+    key += wkt;
+    CPLFree(wkt);
+#if GDAL_VERSION_MAJOR >= 3
+    for (int axis : ref->GetDataAxisToSRSAxisMapping()) key += "," + std::to_string(axis);
+#endif
+    key += "\n";
+  }
+  return key;
+}
+
+OGRCoordinateTransformation *SRSCache::createTransformation(OGRSpatialReference *source, OGRSpatialReference *target) {
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 1)
+  std::string key = getCapacity() > 0 ? transformationKey(source, target) : std::string();
+  if (!key.empty()) {
+    std::lock_guard<std::mutex> guard(lock);
+    OGRCoordinateTransformation *cached = transformations.get(key);
+    OGRCoordinateTransformation *copy = cached ? cached->Clone() : nullptr;
+    if (copy != nullptr) return copy;
+  }
+#endif
+
+  OGRCoordinateTransformation *ct = OGRCreateCoordinateTransformation(source, target);
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 1)
+  if (ct != nullptr && !key.empty()) {
+    OGRCoordinateTransformation *copy = ct->Clone();
+    if (copy != nullptr) {
+      std::lock_guard<std::mutex> guard(lock);
+      transformations.put(key, copy, capacity);
+    }
+  }
+#endif
+  return ct;
+}
+
+size_t SRSCache::getCapacity() {
+  std::lock_guard<std::mutex> guard(lock);
+  return capacity;
+}
+
+void SRSCache::setCapacity(size_t size) {
+  std::lock_guard<std::mutex> guard(lock);
+  capacity = size;
+  srs.trim(capacity);
+  transformations.trim(capacity);
+}
+
+void SRSCache::clear() {
+  std::lock_guard<std::mutex> guard(lock);
+  srs.clear();
+  transformations.clear();
+}
+
+SRSCacheStats SRSCache::srsStats() {
+  std::lock_guard<std::mutex> guard(lock);
+  return {srs.hits, srs.misses, srs.size()};
+}
+
+SRSCacheStats SRSCache::transformationStats() {
+  std::lock_guard<std::mutex> guard(lock);
+  return {transformations.hits, transformations.misses, transformations.size()};
+}
+
+} // namespace node_gdal
@@ -0,0 +1,87 @@
+#ifndef __SRS_CACHE_H__
+#define __SRS_CACHE_H__
+
+// ogr
+#include <ogrsf_frmts.h>
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace node_gdal {
+
+// A process-wide LRU cache of the parsed spatial references and of the
+// coordinate transformation pipelines, both are expensive to create as they
+// involve PROJ database lookups
+//
+// The cache owns its objects and always returns copies, it can be accessed
+// from any thread
+
+struct SRSCacheStats {
+  size_t hits;
+  size_t misses;
+  size_t size;
+};
+
+template <typename T> class LRUCache {
+    public:
+  typedef void (*Deleter)(T *);
+
+  LRUCache(Deleter deleter);
+  ~LRUCache();
+
+  // Returns the cached object and marks it as the most recently used one
+  // or nullptr if it is not in the cache, the caller must hold the lock
+  T *get(const std::string &key);
+  // Takes ownership of the object, the caller must hold the lock
+  void put(const std::string &key, T *obj, size_t capacity);
+  void trim(size_t capacity);
+  void clear();
+
+  size_t hits;
+  size_t misses;
+  inline size_t size() {
+    return items.size();
+  }
+
+    private:
+  typedef std::list<std::pair<std::string, T *>> List;
+  List items;
+  std::unordered_map<std::string, typename List::iterator> index;
+  Deleter deleter;
+};
+
+class SRSCache {
+    public:
+  SRSCache();
+
+  // Returns a copy of the cached spatial reference or nullptr
+  OGRSpatialReference *getSRS(const std::string &key);
+  // Stores a copy of the spatial reference
+  void putSRS(const std::string &key, const OGRSpatialReference *srs);
+
+  // Returns a new transformation between the two spatial references,
+  // reusing a cached pipeline if one exists
+  OGRCoordinateTransformation *createTransformation(OGRSpatialReference *source, OGRSpatialReference *target);
+
+  size_t getCapacity();
+  void setCapacity(size_t capacity);
+  void clear();
+  SRSCacheStats srsStats();
+  SRSCacheStats transformationStats();
+
+    private:
+  std::string transformationKey(OGRSpatialReference *source, OGRSpatialReference *target);
+
+  std::mutex lock;
+  size_t capacity;
+  LRUCache<OGRSpatialReference> srs;
+  LRUCache<OGRCoordinateTransformation> transformations;
+};
+
+extern SRSCache srs_cache;
+
+} // namespace node_gdal
+
+#endif
@@ -73,6 +73,12 @@ Local<Value> TypedArray::New(GDALDataType type, int64_t length) {
 // Create a new TypedArray view over an existing memory buffer
 // This function throws because it is meant to be used inside a pixel function
 Local<Value> TypedArray::New(GDALDataType type, void *data, int64_t length) {
+  return New(type, data, length, [](char *, void *) {}, nullptr);
+}
+
+// Same as above, but free_cb is called with hint once the memory is not referenced by JS anymore
+// free_cb is never called if this function throws because of an unsupported type
+Local<Value> TypedArray::New(GDALDataType type, void *data, int64_t length, Nan::FreeCallback free_cb, void *hint) {
   Nan::EscapableHandleScope scope;
 
   Local<Object> global = Nan::GetCurrentContext()->Global();
@@ -91,10 +97,8 @@ Local<Value> TypedArray::New(GDALDataType type, void *data, int64_t length) {
 
   size_t size = GDALGetDataTypeSizeBytes(type);
 
-  // make ArrayBuffer with external storage by creating a Node.js Buffer w/ an empty free callback
-  Local<Object> buffer = Nan::NewBuffer(
-                           reinterpret_cast<char *>(data), length * size, [](char *, void *) {}, nullptr)
-                           .ToLocalChecked();
+  // make ArrayBuffer with external storage by creating a Node.js Buffer w/ the free callback
+  Local<Object> buffer = Nan::NewBuffer(reinterpret_cast<char *>(data), length * size, free_cb, hint).ToLocalChecked();
 
   if (buffer.IsEmpty() || !buffer->IsObject()) { throw "Error getting creating Node.js Buffer"; }
 
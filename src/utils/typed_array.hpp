@@ -47,6 +47,7 @@ namespace TypedArray {
 
 Local<Value> New(GDALDataType type, int64_t length);
 Local<Value> New(GDALDataType type, void *data, int64_t length);
+Local<Value> New(GDALDataType type, void *data, int64_t length, Nan::FreeCallback free_cb, void *hint);
 GDALDataType Identify(Local<Object> array);
 void *Validate(Local<Object> obj, GDALDataType type, int64_t min_length);
 bool ValidateLength(size_t length, int64_t min_length);
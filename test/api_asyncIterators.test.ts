@@ -46,6 +46,20 @@ if (Symbol.asyncIterator) {
             }
             assert.equal(count, layer.features.count())
           })
+          it('should support iterating over several batches', async () => {
+            const ds = gdal.open(path.resolve(__dirname, 'data', 'shp', 'sample.shp'))
+            const layer = ds.layers.get(0)
+            const expected = layer.features.map((f) => f.fid)
+            const batchSize = gdal.LayerFeatures.asyncIteratorBatchSize
+            gdal.LayerFeatures.asyncIteratorBatchSize = 5
+            try {
+              const fids: number[] = []
+              for await (const feature of layer.features) fids.push(feature.fid)
+              assert.deepEqual(fids, expected)
+            } finally {
+              gdal.LayerFeatures.asyncIteratorBatchSize = batchSize
+            }
+          })
           it('should throw error if dataset is destroyed', () => {
             const ds = gdal.open(path.resolve(__dirname, 'data', 'park.geo.json'))
             const layer = ds.layers.get(0)
@@ -116,6 +116,126 @@ describe('gdal', () => {
       assert.equal(gdal.decToDMS(14.12511, 'long', 1), " 14d 7'30.4\"E")
     })
   })
+  describe('"srsCacheSize" property', () => {
+    /* eslint-disable @typescript-eslint/no-explicit-any */
+    let size: number
+    before(() => {
+      size = (gdal as any).srsCacheSize
+    })
+    after(() => {
+      (gdal as any).srsCacheSize = size
+    })
+    beforeEach(() => {
+      gdal.clearSRSCache()
+    })
+    it('should be a positive number by default', () => {
+      assert.isAbove(size, 0)
+    })
+    it('should throw on invalid values', () => {
+      assert.throws(() => {
+        (gdal as any).srsCacheSize = -1
+      }, /must be a positive integer/)
+    })
+    it('should reuse the spatial references', () => {
+      const srs1 = gdal.SpatialReference.fromEPSG(3857)
+      const srs2 = gdal.SpatialReference.fromEPSG(3857)
+      assert.notStrictEqual(srs1, srs2)
+      assert.isTrue(srs1.isSame(srs2))
+      const stats = gdal.getSRSCacheStats()
+      assert.equal(stats.srs.misses, 1)
+      assert.equal(stats.srs.hits, 1)
+      assert.equal(stats.srs.size, 1)
+    })
+    it('should return independent copies', () => {
+      const srs1 = gdal.SpatialReference.fromEPSG(4326)
+      srs1.setWellKnownGeogCS('WGS72')
+      const srs2 = gdal.SpatialReference.fromEPSG(4326)
+      assert.isFalse(srs1.isSame(srs2))
+      assert.isTrue(srs2.isSame(gdal.SpatialReference.fromUserInput('EPSG:4326')))
+    })
+    it('should reuse the coordinate transformations', () => {
+      const wgs84 = gdal.SpatialReference.fromEPSG(4326)
+      const utm = gdal.SpatialReference.fromEPSG(32632)
+      const ct1 = new gdal.CoordinateTransformation(wgs84, utm)
+      const ct2 = new gdal.CoordinateTransformation(wgs84, utm)
+      assert.notStrictEqual(ct1, ct2)
+      const stats = gdal.getSRSCacheStats()
+      assert.equal(stats.transformations.size, 1)
+      assert.equal(stats.transformations.hits, 1)
+      const pt1 = ct1.transformPoint(20, 30)
+      const pt2 = ct2.transformPoint(20, 30)
+      assert.closeTo(pt1.x, pt2.x, 1e-6)
+      assert.closeTo(pt1.y, pt2.y, 1e-6)
+    })
+    it('should not cache anything when set to 0', () => {
+      (gdal as any).srsCacheSize = 0
+      gdal.SpatialReference.fromEPSG(3857)
+      gdal.SpatialReference.fromEPSG(3857)
+      const stats = gdal.getSRSCacheStats()
+      assert.equal(stats.srs.size, 0)
+      assert.equal(stats.srs.hits, 0)
+    })
+    /* eslint-enable @typescript-eslint/no-explicit-any */
+  })
+  describe('"threadPoolSize" property', () => {
+    /* eslint-disable @typescript-eslint/no-explicit-any */
+    let size: number
+    before(() => {
+      size = (gdal as any).threadPoolSize
+    })
+    after(() => {
+      (gdal as any).threadPoolSize = size
+    })
+    it('should be a positive number by default', () => {
+      assert.isAbove(size, 0)
+    })
+    it('should throw on invalid values', () => {
+      assert.throws(() => {
+        (gdal as any).threadPoolSize = -1
+      }, /must be a positive integer/)
+    })
+    // The idle threads exit asynchronously after a resize
+    const waitForThreads = async (n: number) => {
+      for (let i = 0; i < 100 && (gdal as any)._threadPoolThreads() !== n; i++) {
+        await new Promise((resolve) => setTimeout(resolve, 10))
+      }
+      assert.equal((gdal as any)._threadPoolThreads(), n)
+    }
+    it('should run async operations on the libuv thread pool when set to 0', async () => {
+      (gdal as any).threadPoolSize = 2
+      await gdal.openAsync(`${__dirname}/data/sample.tif`)
+      assert.isAbove((gdal as any)._threadPoolThreads(), 0);
+      (gdal as any).threadPoolSize = 0
+      assert.equal((gdal as any).threadPoolSize, 0)
+      await waitForThreads(0)
+      const ds = await gdal.openAsync(`${__dirname}/data/sample.tif`)
+      const data = await ds.bands.get(1).pixels.readAsync(0, 0, 16, 16)
+      assert.instanceOf(data, Uint8Array)
+      // No thread has been started for these operations
+      assert.equal((gdal as any)._threadPoolThreads(), 0)
+      ds.close()
+    })
+    it('should start the threads on demand', async () => {
+      (gdal as any).threadPoolSize = 0;
+      (gdal as any).threadPoolSize = 4
+      await waitForThreads(0)
+      const ds = await gdal.openAsync(`${__dirname}/data/sample.tif`)
+      assert.equal((gdal as any)._threadPoolThreads(), 1)
+      ds.close()
+    })
+    it('should run async operations with a resized thread pool', () => {
+      (gdal as any).threadPoolSize = 2
+      const ds = gdal.open(`${__dirname}/data/sample.tif`)
+      const q = []
+      for (let i = 0; i < 8; i++) q.push(ds.bands.get(1).pixels.readAsync(0, 0, 16, 16))
+      return Promise.all(q).then((data) => {
+        data.forEach((d) => assert.instanceOf(d, Uint8Array))
+        assert.isAtMost((gdal as any)._threadPoolThreads(), 2)
+        ds.close()
+      })
+    })
+    /* eslint-enable @typescript-eslint/no-explicit-any */
+  })
   describe('Node.js Async callback error convention', () => {
     it('should return null for error on success', (done) => {
       gdal.openAsync(`${__dirname}/data/sample.tif`, (error, result) => {
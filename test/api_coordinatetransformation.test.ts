@@ -1,5 +1,6 @@
 import * as gdal from 'gdal-async'
 import { assert } from 'chai'
+import * as semver from 'semver'
 
 describe('gdal.CoordinateTransformation', () => {
   // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
@@ -32,6 +33,25 @@ describe('gdal.CoordinateTransformation', () => {
     assert.closeTo(pt.x, 1564201.4044502454, 0.1)
     assert.closeTo(pt.y, 3370263.469590679, 0.1)
   })
+  describe('createAsync()', () => {
+    it('should create a CoordinateTransformation', () => {
+      const srs0 = gdal.SpatialReference.fromProj4('+init=epsg:4326')
+      const srs1 = gdal.SpatialReference.fromProj4('+init=epsg:32632')
+
+      return gdal.CoordinateTransformation.createAsync(srs0, srs1).then((ct) => {
+        assert.instanceOf(ct, gdal.CoordinateTransformation)
+        const pt = ct.transformPoint(20, 30)
+        assert.closeTo(pt.x, 1564201.4044502454, 0.1)
+        assert.closeTo(pt.y, 3370263.469590679, 0.1)
+      })
+    })
+    it('should throw on invalid arguments', () => {
+      assert.throws(() => {
+        // eslint-disable-next-line @typescript-eslint/no-explicit-any
+        gdal.CoordinateTransformation.create(gdal.SpatialReference.fromEPSG(4326), {} as any)
+      }, /target must be an instance of SpatialReference/)
+    })
+  })
   describe('transformPoint()', () => {
     let ct: gdal.CoordinateTransformation
     beforeEach(() => {
@@ -63,4 +83,70 @@ describe('gdal.CoordinateTransformation', () => {
       }, /point must contain numerical properties x and y/)
     })
   })
+  describe('transformArrays()', () => {
+    let ct: gdal.CoordinateTransformation
+    beforeEach(() => {
+      const srs0 = gdal.SpatialReference.fromProj4('+init=epsg:4326')
+      const srs1 = gdal.SpatialReference.fromProj4('+init=epsg:32632')
+      ct = new gdal.CoordinateTransformation(srs0, srs1)
+    })
+    it('should transform the arrays in place', () => {
+      const xs = Float64Array.from([ 20, 20 ])
+      const ys = Float64Array.from([ 30, 30 ])
+      const zs = Float64Array.from([ 0, 100 ])
+      const errors = ct.transformArrays(xs, ys, zs)
+
+      assert.instanceOf(errors, Int32Array)
+      assert.deepEqual(Array.from(errors), [ 0, 0 ])
+      for (let i = 0; i < 2; i++) {
+        assert.closeTo(xs[i], 1564201.4044502454, 0.1)
+        assert.closeTo(ys[i], 3370263.469590679, 0.1)
+      }
+      assert.closeTo(zs[1], 100, 0.1)
+    })
+    it('should return an error code for the invalid points', () => {
+      const xs = Float64Array.from([ 20, 400 ])
+      const ys = Float64Array.from([ 30, 120 ])
+      const errors = ct.transformArrays(xs, ys)
+
+      assert.equal(errors[0], 0)
+      assert.notEqual(errors[1], 0)
+      assert.closeTo(xs[0], 1564201.4044502454, 0.1)
+    })
+    it('should throw on invalid arguments', () => {
+      assert.throws(() => {
+        // eslint-disable-next-line @typescript-eslint/no-explicit-any
+        ct.transformArrays(Float64Array.from([ 20 ]), [ 30 ] as any)
+      }, /ys must be a Float64Array/)
+      assert.throws(() => {
+        ct.transformArrays(Float64Array.from([ 20 ]), Float64Array.from([ 30, 31 ]))
+      }, /same length/)
+    })
+  })
+  describe('transformArraysAsync()', () => {
+    it('should transform the arrays in place', function () {
+      if (semver.lt(gdal.version, '3.1.0')) this.skip()
+      const srs0 = gdal.SpatialReference.fromProj4('+init=epsg:4326')
+      const srs1 = gdal.SpatialReference.fromProj4('+init=epsg:32632')
+      const ct = new gdal.CoordinateTransformation(srs0, srs1)
+      const xs = new Float64Array(1000).fill(20)
+      const ys = new Float64Array(1000).fill(30)
+
+      return ct.transformArraysAsync(xs, ys).then((errors) => {
+        assert.lengthOf(errors, 1000)
+        assert.isTrue(errors.every((e) => e === 0))
+        assert.isTrue(xs.every((x) => Math.abs(x - 1564201.4044502454) < 0.1))
+        assert.isTrue(ys.every((y) => Math.abs(y - 3370263.469590679) < 0.1))
+      })
+    })
+    it('should throw with GDAL < 3.1', function () {
+      if (semver.gte(gdal.version, '3.1.0')) this.skip()
+      const srs0 = gdal.SpatialReference.fromProj4('+init=epsg:4326')
+      const srs1 = gdal.SpatialReference.fromProj4('+init=epsg:32632')
+      const ct = new gdal.CoordinateTransformation(srs0, srs1)
+      return ct.transformArraysAsync(new Float64Array(1), new Float64Array(1)).then(
+        () => assert.fail('should have been rejected'),
+        (e) => assert.match(e.message, /requires GDAL >= 3.1/))
+    })
+  })
 })
@@ -929,6 +929,69 @@ describe('gdal.Dataset', () => {
         return assert.isRejected(ds.flushAsync())
       })
     })
+    describe('startTransaction()', () => {
+      let ds: gdal.Dataset, layer: gdal.Layer, file: string
+      const addPoint = (i: number) => {
+        const f = new gdal.Feature(layer)
+        f.setGeometry(new gdal.Point(i, i))
+        return f
+      }
+      beforeEach(() => {
+        file = `/vsimem/ds_tx_test.${String(Math.random()).substring(2)}.tmp.gpkg`
+        ds = gdal.open(file, 'w', 'GPKG')
+        layer = ds.layers.create('points', null, gdal.wkbPoint)
+      })
+      afterEach(() => {
+        ds.close()
+        gdal.vsimem.release(file)
+      })
+      it('should commit the features', () => {
+        ds.startTransaction()
+        layer.features.add(addPoint(1))
+        ds.commitTransaction()
+        assert.equal(layer.features.count(), 1)
+      })
+      it('should roll back the features', async () => {
+        await ds.startTransactionAsync()
+        layer.features.add(addPoint(1))
+        await ds.rollbackTransactionAsync()
+        assert.equal(layer.features.count(), 0)
+      })
+      it('should throw when there is no transaction', () => {
+        assert.throws(() => {
+          ds.commitTransaction()
+        })
+      })
+      it('should throw if dataset already closed', () => {
+        const closed = gdal.open(path.join(__dirname, 'data', 'sample.vrt'))
+        closed.close()
+        assert.throws(() => {
+          closed.startTransaction()
+        }, /already been destroyed/)
+      })
+      it('should add many features with addMany()', () => {
+        const features = []
+        for (let i = 0; i < 25; i++) features.push(addPoint(i))
+        assert.equal(layer.features.addMany(features, { commitEvery: 10 }), 25)
+        assert.equal(layer.features.count(), 25)
+      })
+      it('should report the committed features when a feature fails in addMany()', () => {
+        const features = []
+        for (let i = 0; i < 25; i++) features.push(addPoint(i))
+        // The fid of an already inserted feature fails the second transaction
+        features[15].fid = 1
+        assert.throws(() => {
+          layer.features.addMany(features, { commitEvery: 10 })
+        }, /\(10 features committed\)/)
+        assert.equal(layer.features.count(), 10)
+      })
+      it('should add many features with addManyAsync()', async () => {
+        const features = []
+        for (let i = 0; i < 5; i++) features.push(addPoint(i))
+        assert.equal(await layer.features.addManyAsync(features), 5)
+        assert.equal(layer.features.count(), 5)
+      })
+    })
     describe('getMetadata()', () => {
       it('should return object', () => {
         const ds = gdal.open(`${__dirname}/data/sample.tif`)
@@ -1001,6 +1064,67 @@ describe('gdal.Dataset', () => {
         return assert.isRejected(ds.setMetadataAsync({}))
       })
     })
+    describe('read()', () => {
+      it('should read all bands band-interleaved by default', () => {
+        const ds = gdal.open(`${__dirname}/data/multiband.tif`)
+        const n = ds.bands.count()
+        const data = ds.read(10, 20, 16, 8)
+        assert.instanceOf(data, Uint8Array)
+        assert.lengthOf(data, 16 * 8 * n)
+        for (let b = 1; b <= n; b++) {
+          assert.deepEqual(data.subarray((b - 1) * 16 * 8, b * 16 * 8), ds.bands.get(b).pixels.read(10, 20, 16, 8))
+        }
+      })
+      it('should read pixel-interleaved selected bands', () => {
+        const ds = gdal.open(`${__dirname}/data/multiband.tif`)
+        const bands = [ 3, 1 ]
+        const data = ds.read(0, 0, 8, 8, { bands, interleave: 'pixel' })
+        assert.lengthOf(data, 8 * 8 * bands.length)
+        const expected = bands.map((b) => ds.bands.get(b).pixels.read(0, 0, 8, 8))
+        for (let i = 0; i < 8 * 8; i++) {
+          assert.equal(data[i * 2], expected[0][i])
+          assert.equal(data[i * 2 + 1], expected[1][i])
+        }
+      })
+      it('should put the data in an existing array', () => {
+        const ds = gdal.open(`${__dirname}/data/multiband.tif`)
+        const data = new Float32Array(4 * 4 * 2)
+        const result = ds.read(0, 0, 4, 4, { bands: [ 1, 2 ], data })
+        assert.strictEqual(result, data)
+        assert.equal(data[5], ds.bands.get(1).pixels.get(1, 1))
+      })
+      it('should throw on invalid arguments', () => {
+        const ds = gdal.open(`${__dirname}/data/multiband.tif`)
+        assert.throws(() => {
+          ds.read(0, 0, 4, 4, { bands: [ 1, 42 ] })
+        }, /invalid band id/)
+        assert.throws(() => {
+          // eslint-disable-next-line @typescript-eslint/no-explicit-any
+          ds.read(0, 0, 4, 4, { interleave: 'line' as any })
+        }, /interleave/)
+        assert.throws(() => {
+          ds.read(0, 0, 4, 4, { data: new Uint8Array(4) })
+        })
+      })
+      it('should throw if dataset is closed', () => {
+        const ds = gdal.open(`${__dirname}/data/multiband.tif`)
+        ds.close()
+        assert.throws(() => {
+          ds.read(0, 0, 4, 4)
+        }, /already been destroyed/)
+      })
+    })
+    describe('readAsync()', () => {
+      it('should read all bands', () => {
+        const ds = gdal.open(`${__dirname}/data/multiband.tif`)
+        const expected = ds.read(0, 0, 32, 32, { interleave: 'pixel' })
+        return assert.eventually.deepEqual(ds.readAsync(0, 0, 32, 32, { interleave: 'pixel' }), expected)
+      })
+      it('should reject on an invalid region', () => {
+        const ds = gdal.open(`${__dirname}/data/multiband.tif`)
+        return assert.isRejected(ds.readAsync(2000, 2000, 32, 32))
+      })
+    })
     describe('buildOverviews()', () => {
       it('should generate overviews for all bands', () => {
         const tempFile = fileUtils.clone(`${__dirname}/data/multiband.tif`)
@@ -238,6 +238,56 @@ describe('gdal.Geometry', () => {
       })
     })
   }
+  describe('fromCoordinates()', () => {
+    it('should create a LineString', () => {
+      const line = gdal.Geometry.fromCoordinates(gdal.wkbLineString, Float64Array.from([ 0, 1, 2, 3, 4, 5 ]))
+      assert.instanceOf(line, gdal.LineString)
+      assert.equal(line.toWKT(), 'LINESTRING (0 1,2 3,4 5)')
+    })
+    it('should create a 3D LineString', () => {
+      const line = gdal.Geometry.fromCoordinates(gdal.wkbLineString25D, Float64Array.from([ 0, 1, 2, 3, 4, 5 ]))
+      assert.equal(line.coordinateDimension, 3)
+      assert.equal((line as gdal.LineString).points.count(), 2)
+      assert.equal((line as gdal.LineString).points.get(1).z, 5)
+    })
+    it('should create a Polygon with holes', () => {
+      const poly = gdal.Geometry.fromCoordinates(gdal.wkbPolygon,
+        Float64Array.from([ 0, 0, 10, 0, 10, 10, 0, 0, 1, 1, 2, 1, 2, 2, 1, 1 ]),
+        Uint32Array.from([ 0, 4, 8 ]))
+      assert.instanceOf(poly, gdal.Polygon)
+      assert.equal((poly as gdal.Polygon).rings.count(), 2)
+    })
+    it('should be the inverse of getCoordinates()', () => {
+      const wkt = 'MULTIPOLYGON (((0 0,10 0,10 10,0 0),(1 1,2 1,2 2,1 1)),((20 20,30 20,30 30,20 20)))'
+      const { coordinates, offsets, parts, dims } = gdal.Geometry.fromWKT(wkt).getCoordinates()
+      const multi = gdal.Geometry.fromCoordinates(gdal.wkbMultiPolygon, coordinates, offsets, { parts, dims })
+      assert.instanceOf(multi, gdal.MultiPolygon)
+      assert.equal(multi.toWKT(), wkt)
+    })
+    it('should create a MultiPoint', () => {
+      const multi = gdal.Geometry.fromCoordinates(gdal.wkbMultiPoint, Float64Array.from([ 0, 1, 2, 3 ]))
+      assert.instanceOf(multi, gdal.MultiPoint)
+      assert.equal((multi as gdal.MultiPoint).children.count(), 2)
+    })
+    it('should throw on invalid offsets', () => {
+      assert.throws(() => {
+        gdal.Geometry.fromCoordinates(gdal.wkbPolygon, Float64Array.from([ 0, 0, 1, 1 ]), Uint32Array.from([ 0, 4 ]))
+      }, /Invalid ring offsets/)
+    })
+    it('should throw on unsupported types', () => {
+      assert.throws(() => {
+        gdal.Geometry.fromCoordinates(gdal.wkbCircularString, Float64Array.from([ 0, 0, 1, 1 ]))
+      }, /Unsupported geometry type/)
+    })
+  })
+  describe('fromCoordinatesAsync()', () => {
+    it('should create a LineString', () =>
+      gdal.Geometry.fromCoordinatesAsync(gdal.wkbLineString, Float64Array.from([ 0, 1, 2, 3 ])).then((line) => {
+        assert.instanceOf(line, gdal.LineString)
+        assert.equal(line.toWKT(), 'LINESTRING (0 1,2 3)')
+      })
+    )
+  })
   describe('getConstructor()', () => {
     //  wkbUnknown = 0, wkbPoint = 1, wkbLineString = 2, wkbPolygon = 3,
     //  wkbMultiPoint = 4, wkbMultiLineString = 5, wkbMultiPolygon = 6, wkbGeometryCollection = 7,
@@ -748,6 +798,57 @@ describe('gdal.Geometry', () => {
         ]))
       })
     })
+    describe('getCoordinates()', () => {
+      it('should return the coordinates of a LineString', () => {
+        const line = gdal.Geometry.fromWKT('LINESTRING (0 1, 2 3, 4 5)')
+        const r = line.getCoordinates()
+        assert.equal(r.dims, 2)
+        assert.instanceOf(r.coordinates, Float64Array)
+        assert.deepEqual(Array.from(r.coordinates), [ 0, 1, 2, 3, 4, 5 ])
+        assert.instanceOf(r.offsets, Uint32Array)
+        assert.deepEqual(Array.from(r.offsets), [ 0, 3 ])
+        assert.deepEqual(Array.from(r.parts), [ 0, 1 ])
+      })
+      it('should return the rings and the parts of a MultiPolygon', () => {
+        const multi = gdal.Geometry.fromWKT(
+          'MULTIPOLYGON (((0 0, 10 0, 10 10, 0 0), (1 1, 2 1, 2 2, 1 1)), ((20 20, 30 20, 30 30, 20 20)))')
+        const r = multi.getCoordinates({ dims: 2 })
+        assert.lengthOf(r.coordinates, 24)
+        assert.deepEqual(Array.from(r.offsets), [ 0, 4, 8, 12 ])
+        assert.deepEqual(Array.from(r.parts), [ 0, 2, 3 ])
+        assert.deepEqual(Array.from(r.coordinates.subarray(16, 18)), [ 20, 20 ])
+      })
+      it('should support forcing the dimensions', () => {
+        const point3d = gdal.Geometry.fromWKT('POINT Z (1 2 3)')
+        assert.equal(point3d.getCoordinates().dims, 3)
+        assert.deepEqual(Array.from(point3d.getCoordinates().coordinates), [ 1, 2, 3 ])
+        assert.deepEqual(Array.from(point3d.getCoordinates({ dims: 2 }).coordinates), [ 1, 2 ])
+        const point2d = gdal.Geometry.fromWKT('POINT (1 2)')
+        assert.deepEqual(Array.from(point2d.getCoordinates({ dims: 3 }).coordinates), [ 1, 2, 0 ])
+      })
+      it('should flatten geometry collections', () => {
+        const coll = gdal.Geometry.fromWKT('GEOMETRYCOLLECTION (POINT (1 2), LINESTRING (0 0, 1 1))')
+        const r = coll.getCoordinates()
+        assert.deepEqual(Array.from(r.coordinates), [ 1, 2, 0, 0, 1, 1 ])
+        assert.deepEqual(Array.from(r.offsets), [ 0, 1, 3 ])
+        assert.deepEqual(Array.from(r.parts), [ 0, 1, 2 ])
+      })
+      it('should throw on invalid dimensions', () => {
+        assert.throws(() => {
+          gdal.Geometry.fromWKT('POINT (1 2)').getCoordinates({ dims: 4 })
+        }, /dims must be 2 or 3/)
+      })
+    })
+    describe('getCoordinatesAsync()', () => {
+      it('should return the coordinates of a Polygon', () => {
+        const poly = gdal.Geometry.fromWKT('POLYGON ((0 0, 10 0, 10 10, 0 0))')
+        return poly.getCoordinatesAsync().then((r) => {
+          assert.deepEqual(Array.from(r.coordinates), [ 0, 0, 10, 0, 10, 10, 0, 0 ])
+          assert.deepEqual(Array.from(r.offsets), [ 0, 4 ])
+          assert.deepEqual(Array.from(r.parts), [ 0, 1 ])
+        })
+      })
+    })
     describe('segmentize()', () => {
       it('should segmentize the geometry', () => {
         const line = new gdal.LineString()
@@ -413,6 +413,56 @@ describe('gdal.Layer', () => {
       })
     })
 
+    describe('setIgnoredFields()', () => {
+      it('should omit the ignored fields', () => {
+        prepare_dataset_layer_test('r', (dataset, layer) => {
+          layer.setIgnoredFields([ 'path', 'long_name', 'OGR_GEOMETRY' ])
+          const feature = layer.features.first()
+          const obj = feature.fields.toObject()
+          assert.notProperty(obj, 'path')
+          assert.notProperty(obj, 'long_name')
+          assert.equal(obj.name, 'Park')
+          assert.lengthOf(feature.fields.toArray(), feature.fields.count() - 2)
+          assert.isNull(feature.getGeometry())
+        })
+      })
+      it('should retrieve all fields when passed null', () => {
+        prepare_dataset_layer_test('r', (dataset, layer) => {
+          layer.setIgnoredFields([ 'path' ])
+          layer.setIgnoredFields(null)
+          assert.property(layer.features.first().fields.toObject(), 'path')
+        })
+      })
+      it('should throw error if dataset is destroyed', () => {
+        prepare_dataset_layer_test('r', (dataset, layer) => {
+          dataset.close()
+          assert.throws(() => {
+            layer.setIgnoredFields([ 'path' ])
+          }, /already been destroyed/)
+        })
+      })
+    })
+
+    describe('selectFields()', () => {
+      it('should retrieve only the selected fields', () => {
+        prepare_dataset_layer_test('r', (dataset, layer) => {
+          layer.selectFields([ 'name', 'fips' ])
+          const feature = layer.features.first()
+          assert.deepEqual(Object.keys(feature.fields.toObject()), [ 'name', 'fips' ])
+          assert.instanceOf(feature.getGeometry(), gdal.Geometry)
+          layer.selectFields(null)
+          assert.lengthOf(Object.keys(layer.features.first().fields.toObject()), layer.fields.count())
+        })
+      })
+      it('should throw on unknown fields', () => {
+        prepare_dataset_layer_test('r', (dataset, layer) => {
+          assert.throws(() => {
+            layer.selectFields([ 'unknown' ])
+          }, /does not exist/)
+        })
+      })
+    })
+
     describe('"features" property', () => {
       describe('getter', () => {
         it('should return LayerFeatures', () => {
@@ -1053,5 +1103,155 @@ describe('gdal.Layer', () => {
         })
       })
     })
+    describe('getArrowStream()', () => {
+      let ds: gdal.Dataset, layer: gdal.Layer
+      before(function () {
+        if (semver.lt(gdal.version, '3.6.0')) this.skip()
+      })
+      beforeEach(() => {
+        ds = gdal.open('temp', 'w', 'Memory')
+        layer = ds.layers.create('arrow', null, gdal.wkbPoint)
+        layer.fields.add(new gdal.FieldDefn('id', gdal.OFTInteger))
+        layer.fields.add(new gdal.FieldDefn('value', gdal.OFTReal))
+        layer.fields.add(new gdal.FieldDefn('name', gdal.OFTString))
+        for (let i = 0; i < 10; i++) {
+          const f = new gdal.Feature(layer)
+          f.fields.set('id', i)
+          f.fields.set('value', i / 2)
+          if (i !== 3) f.fields.set('name', `feature ${i}`)
+          f.setGeometry(new gdal.Point(i, -i))
+          layer.features.add(f)
+        }
+      })
+      afterEach(() => {
+        try {
+          ds.close()
+        } catch (e) {
+          /* ignore */
+        }
+      })
+      it('should return the features in columns', () => {
+        const stream = layer.getArrowStream({ INCLUDE_FID: 'NO' })
+        assert.instanceOf(stream, gdal.ArrowStream)
+        const batch = stream.next() as gdal.ArrowRecordBatch
+        assert.equal(batch.length, 10)
+        assert.instanceOf(batch.columns.id.values, Int32Array)
+        assert.deepEqual(Array.from(batch.columns.id.values as Int32Array), [ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 ])
+        assert.instanceOf(batch.columns.value.values, Float64Array)
+        assert.equal(batch.columns.value.values[5], 2.5)
+        assert.isNull(batch.columns.id.validity)
+
+        const name = batch.columns.name
+        assert.equal(name.type, 'u')
+        assert.instanceOf(name.offsets, Int32Array)
+        const offsets = name.offsets as Int32Array
+        const text = Buffer.from(name.values.buffer, name.values.byteOffset, name.values.byteLength)
+        assert.equal(text.toString('utf8', offsets[1], offsets[2]), 'feature 1')
+        assert.isNotNull(name.validity)
+        assert.equal((name.validity as Uint8Array)[3], 0)
+        assert.equal((name.validity as Uint8Array)[4], 1)
+
+        const geom = Object.values(batch.columns).find((c) => c.type === 'z') as gdal.ArrowColumn
+        assert.isDefined(geom)
+        const wkbOffsets = geom.offsets as Int32Array
+        const wkb = Buffer.from(geom.values.buffer, geom.values.byteOffset, geom.values.byteLength)
+        const point = gdal.Geometry.fromWKB(wkb.subarray(wkbOffsets[7], wkbOffsets[8])) as gdal.Point
+        assert.equal(point.x, 7)
+        assert.equal(point.y, -7)
+
+        assert.isNull(stream.next())
+      })
+      it('should support iterating over several batches', async () => {
+        const stream = await layer.getArrowStreamAsync({ MAX_FEATURES_IN_BATCH: 4 })
+        const lengths = []
+        const ids = []
+        for await (const batch of stream) {
+          lengths.push(batch.length)
+          ids.push(...Array.from(batch.columns.id.values as Int32Array))
+        }
+        assert.deepEqual(lengths, [ 4, 4, 2 ])
+        assert.deepEqual(ids, [ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 ])
+      })
+      it('should end the stream when it is closed', () => {
+        const stream = layer.getArrowStream({ MAX_FEATURES_IN_BATCH: 4 })
+        assert.isNotNull(stream.next())
+        stream.close()
+        assert.isNull(stream.next())
+      })
+      it('should release the stream when the dataset is closed', () => {
+        const stream = layer.getArrowStream()
+        ds.close()
+        assert.throws(() => {
+          stream.next()
+        }, /already been released/)
+      })
+    })
+    describe('writeBatch()', () => {
+      let ds: gdal.Dataset, layer: gdal.Layer
+      beforeEach(() => {
+        ds = gdal.open('temp', 'w', 'Memory')
+        layer = ds.layers.create('batch', null, gdal.wkbPoint)
+        layer.fields.add(new gdal.FieldDefn('id', gdal.OFTInteger))
+        layer.fields.add(new gdal.FieldDefn('value', gdal.OFTReal))
+        layer.fields.add(new gdal.FieldDefn('name', gdal.OFTString))
+      })
+      afterEach(() => {
+        ds.close()
+      })
+      const wkbBatch = (n: number) => {
+        const wkbs = []
+        const offsets = new Int32Array(n + 1)
+        for (let i = 0; i < n; i++) {
+          wkbs.push(new gdal.Point(i, -i).toWKB())
+          offsets[i + 1] = offsets[i] + wkbs[i].length
+        }
+        return { geometryWKB: Buffer.concat(wkbs), offsets }
+      }
+      it('should create the features from columns', () => {
+        const n = layer.writeBatch({
+          columns: {
+            id: new Int32Array([ 0, 1, 2 ]),
+            value: new Float64Array([ 0.5, 1.5, 2.5 ]),
+            name: [ 'first', null, 'third' ]
+          },
+          ...wkbBatch(3)
+        })
+        assert.equal(n, 3)
+        assert.equal(layer.features.count(), 3)
+        const f = layer.features.get(2)
+        assert.equal(f.fields.get('id'), 2)
+        assert.equal(f.fields.get('value'), 2.5)
+        assert.equal(f.fields.get('name'), 'third')
+        const point = f.getGeometry() as gdal.Point
+        assert.equal(point.x, 2)
+        assert.equal(point.y, -2)
+        assert.isNull(layer.features.get(1).fields.get('name'))
+      })
+      it('should accept features without geometries', async () => {
+        const n = await layer.writeBatchAsync({
+          columns: { id: new Uint32Array([ 7, 8 ]), name: [ 'a', 'b' ] }
+        })
+        assert.equal(n, 2)
+        const f = layer.features.get(1)
+        assert.equal(f.fields.get('id'), 8)
+        assert.isNull(f.getGeometry())
+      })
+      it('should throw on columns of different lengths', () => {
+        assert.throws(() => {
+          layer.writeBatch({ columns: { id: new Int32Array(2), value: new Float64Array(3) } })
+        }, /same length/)
+      })
+      it('should throw on invalid offsets', () => {
+        const batch = wkbBatch(2)
+        batch.offsets[1] = batch.geometryWKB.length + 1
+        assert.throws(() => {
+          layer.writeBatch({ columns: { id: new Int32Array(2) }, ...batch })
+        }, /Invalid geometry offsets/)
+      })
+      it('should reject on unknown fields', () =>
+        layer.writeBatchAsync({ columns: { unknown: new Int32Array(2) } })
+          .then(() => assert.fail('should have been rejected'), (e) => assert.match(e.message, /does not exist/))
+      )
+    })
   })
 })
@@ -448,6 +448,79 @@ describe('gdal.LayerAsync', () => {
       })
     })
 
+    describe('getExtentAsync()', () => {
+      it('should return Envelope', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) =>
+          assert.isFulfilled(layer.getExtentAsync().then((envelope) => {
+            assert.instanceOf(envelope, gdal.Envelope)
+            assert.closeTo(envelope.minX, -111.05687488399991, 0.00001)
+            assert.closeTo(envelope.maxY, 45.00589722600017, 0.00001)
+          })).then(() => cleanupWrite(dataset, file))
+        )
+      )
+      it('should accept an options object', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) =>
+          assert.isFulfilled(layer.getExtentAsync({ force: true, geomField: 0 }).then((envelope) => {
+            assert.deepEqual(envelope, layer.getExtent())
+          })).then(() => cleanupWrite(dataset, file))
+        )
+      )
+      it('should reject on unknown geometry fields', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) =>
+          assert.isRejected(layer.getExtentAsync({ geomField: 'unknown' }), /does not exist/)
+            .then(() => cleanupWrite(dataset, file))
+        )
+      )
+      it('should reject on out of range geometry field indexes', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) =>
+          assert.isRejected(layer.getExtentAsync({ geomField: 1 }), /Geometry field 1 does not exist/)
+            .then(() => cleanupWrite(dataset, file))
+        )
+      )
+    })
+
+    describe('setSpatialFilterAsync()', () => {
+      it('should accept 4 numbers', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+          const count_before = layer.features.count()
+          return assert.isFulfilled(layer.setSpatialFilterAsync(-111, 41, -104, 43).then(() => {
+            assert.isBelow(layer.features.count(), count_before)
+          })).then(() => cleanupWrite(dataset, file))
+        })
+      )
+      it('should accept Geometry and null', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+          const count_before = layer.features.count()
+          const filter = gdal.Geometry.fromWKT('POLYGON ((-111 41, -104 41, -104 43, -111 43, -111 41))')
+          return assert.isFulfilled(layer.setSpatialFilterAsync(filter)
+            .then(() => {
+              assert.isBelow(layer.features.count(), count_before)
+              return layer.setSpatialFilterAsync(null)
+            })
+            .then(() => {
+              assert.equal(layer.features.count(), count_before)
+            })).then(() => cleanupWrite(dataset, file))
+        })
+      )
+    })
+
+    describe('setAttributeFilterAsync()', () => {
+      it('should filter layer by expression', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+          const count_before = layer.features.count()
+          return assert.isFulfilled(layer.setAttributeFilterAsync("name = 'Park'").then(() => {
+            assert.isBelow(layer.features.count(), count_before)
+          })).then(() => cleanupWrite(dataset, file))
+        })
+      )
+      it('should reject on invalid expressions', () =>
+        prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) =>
+          assert.isRejected(layer.setAttributeFilterAsync('name = = ='))
+            .then(() => cleanupWrite(dataset, file))
+        )
+      )
+    })
+
     describe('"features" property', () => {
       describe('getter', () => {
         it('should return LayerFeatures', () => {
@@ -553,6 +626,209 @@ describe('gdal.LayerAsync', () => {
           })
         )
       })
+      describe('nextBatchAsync()', () => {
+        it('should return an array of Features and increment the iterator', () =>
+          prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+            const count = layer.features.count()
+            const expected = layer.features.map((f) => f.fid)
+            layer.features.first()
+            return assert.isFulfilled(layer.features.nextBatchAsync(count - 1)
+              .then((batch) => {
+                assert.isArray(batch)
+                assert.lengthOf(batch, count - 1)
+                batch.forEach((f) => assert.instanceOf(f, gdal.Feature))
+                assert.deepEqual(batch.map((f) => f.fid), expected.slice(1))
+                return layer.features.nextBatchAsync(count)
+              })
+              .then((batch) => assert.lengthOf(batch, 0)))
+              .then(() => cleanupWrite(dataset, file))
+          })
+        )
+        it('should return at most the requested number of Features', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            const count = layer.features.count()
+            const expected = layer.features.map((f) => f.fid)
+            layer.features.first()
+            const batch = layer.features.nextBatch(2)
+            assert.isArray(batch)
+            assert.lengthOf(batch, 2)
+            batch.forEach((f) => assert.instanceOf(f, gdal.Feature))
+            assert.deepEqual(batch.map((f) => f.fid), expected.slice(1, 3))
+            const rest = layer.features.nextBatch(count)
+            assert.lengthOf(rest, count - 3)
+            assert.deepEqual(rest.map((f) => f.fid), expected.slice(3))
+            assert.lengthOf(layer.features.nextBatch(count), 0)
+          })
+        )
+        it('should throw on invalid batch size', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            assert.throws(() => {
+              layer.features.nextBatch(0)
+            }, /at least 1/)
+          })
+        )
+        it('should throw error if dataset is destroyed', () =>
+          prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+            dataset.close()
+            return assert.isRejected(layer.features.nextBatchAsync(10), /already destroyed/)
+              .then(() => cleanupWrite(dataset, file))
+          })
+        )
+      })
+      describe('cursor()', () => {
+        it('should iterate over all features with a single Feature object', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            const expected = layer.features.map((f) => f.fid)
+            const cursor = layer.features.cursor()
+            const fids = []
+            let feature: gdal.Feature | null = null
+            for (const f of cursor) {
+              if (feature) assert.strictEqual(f, feature)
+              feature = f
+              fids.push(f.fid)
+            }
+            assert.deepEqual(fids, expected)
+            assert.isNull(cursor.next())
+          })
+        )
+        it('should support async iteration', () =>
+          prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+            const expected = layer.features.map((f) => f.fields.get('name'))
+            const names: string[] = []
+            return assert.isFulfilled((async () => {
+              for await (const f of layer.features.cursor()) names.push(f.fields.get('name'))
+            })().then(() => assert.deepEqual(names, expected)))
+              .then(() => cleanupWrite(dataset, file))
+          })
+        )
+        it('should keep cloned features', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            const cursor = layer.features.cursor()
+            const first = (cursor.next() as gdal.Feature).clone()
+            cursor.next()
+            assert.equal(first.fid, 0)
+            assert.equal(first.fields.get('name'), 'Park')
+          })
+        )
+        it('should keep the geometries and the fields across steps', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            const expected = layer.features.map((f) => f.getGeometry().toJSON())
+            const names = layer.features.map((f) => f.fields.toObject())
+            const geometries: gdal.Geometry[] = []
+            const fields: Record<string, unknown>[] = []
+            for (const f of layer.features.cursor()) {
+              geometries.push(f.getGeometry())
+              fields.push(f.fields.toObject())
+            }
+            assert.deepEqual(geometries.map((g) => g.toJSON()), expected)
+            assert.deepEqual(fields, names)
+          })
+        )
+        it('should reuse the Feature after a reset', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            const cursor = layer.features.cursor()
+            const first = cursor.next()
+            while (cursor.next());
+            cursor.reset()
+            assert.strictEqual(cursor.next(), first)
+            assert.equal((first as gdal.Feature).fid, 0)
+          })
+        )
+      })
+      describe('queryAsync()', () => {
+        it('should return the features of several windows without duplicates', () =>
+          prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+            const total = layer.features.count()
+            layer.setSpatialFilter(-111, 41, -107, 43)
+            const countA = layer.features.count()
+            layer.setSpatialFilter(-108, 41, -104, 43)
+            const countB = layer.features.count()
+            layer.setSpatialFilter(-111, 41, -104, 43)
+            const countAll = layer.features.count()
+            layer.setSpatialFilter(null)
+            return assert.isFulfilled(layer.features.queryAsync({
+              bboxes: new Float64Array([ -111, 41, -107, 43, -108, 41, -104, 43 ])
+            }).then((result) => {
+              assert.lengthOf(result.windows, 2)
+              assert.lengthOf(result.windows[0], countA)
+              assert.lengthOf(result.windows[1], countB)
+              assert.lengthOf(result.features, countAll)
+              result.features.forEach((f) => assert.instanceOf(f, gdal.Feature))
+              const fids = result.features.map((f) => f.fid)
+              assert.lengthOf(new Set(fids), fids.length)
+              assert.equal(layer.features.count(), total)
+            })).then(() => cleanupWrite(dataset, file))
+          })
+        )
+        it('should support where, fields and limit', () =>
+          prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+            const result = layer.features.query({
+              bboxes: new Float64Array([ -180, -90, 180, 90 ]),
+              where: "name = 'Park'",
+              fields: [ 'name' ],
+              limit: 1
+            })
+            assert.lengthOf(result.features, 1)
+            assert.equal(result.features[0].fields.get('name'), 'Park')
+            assert.isNull(result.features[0].fields.get('type'))
+            assert.isTrue(result.truncated)
+            cleanupWrite(dataset, file)
+          })
+        )
+        it('should restore the filters and the ignored fields of the layer', () =>
+          prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+            layer.setSpatialFilter(-111, 41, -107, 43)
+            layer.setAttributeFilter("name <> 'Park'")
+            layer.setIgnoredFields([ 'type' ])
+            const count = layer.features.count()
+            return assert.isFulfilled(layer.features.queryAsync({
+              bboxes: new Float64Array([ -180, -90, 180, 90 ]),
+              fields: [ 'name' ]
+            }).then((result) => {
+              assert.isFalse(result.truncated)
+              assert.equal(layer.features.count(), count)
+              assert.isNotNull(layer.getSpatialFilter())
+              const feature = layer.features.first() as gdal.Feature
+              assert.notEqual(feature.fields.get('name'), 'Park')
+              assert.isNull(feature.fields.get('type'))
+              assert.notProperty(feature.fields.toObject(), 'type')
+            })).then(() => cleanupWrite(dataset, file))
+          })
+        )
+        it('should throw on invalid bboxes', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            assert.throws(() => {
+              layer.features.query({ bboxes: new Float64Array(3) })
+            }, /4 values/)
+          })
+        )
+      })
+      describe('toObjectsAsync()', () => {
+        it('should return the fields of the next features as plain objects', () =>
+          prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
+            const count = layer.features.count()
+            const expected = layer.features.map((f) => f.fields.toObject())
+            layer.features.first()
+            return assert.isFulfilled(layer.features.toObjectsAsync(count)
+              .then((batch) => {
+                assert.isArray(batch)
+                assert.lengthOf(batch, count - 1)
+                batch.forEach((o) => assert.notInstanceOf(o, gdal.Feature))
+                assert.deepEqual(batch, expected.slice(1))
+                return layer.features.toObjectsAsync(count)
+              })
+              .then((batch) => assert.lengthOf(batch, 0)))
+              .then(() => cleanupWrite(dataset, file))
+          })
+        )
+        it('should throw on invalid batch size', () =>
+          prepare_dataset_layer_test('r', (dataset, layer) => {
+            assert.throws(() => {
+              layer.features.toObjects(0)
+            }, /at least 1/)
+          })
+        )
+      })
       describe('firstAsync()', () => {
         it('should return a Feature and reset the iterator', () =>
           prepare_dataset_layer_test('r', { autoclose: false }, (dataset, layer, file) => {
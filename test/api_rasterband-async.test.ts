@@ -139,6 +139,47 @@ describe('gdal.RasterBandAsync', () => {
             }))
           }))
         })
+        it('should queue parallel reads on the same dataset', () => {
+          const ds1 = gdal.open(`${__dirname}/data/sample.tif`)
+          const ds2 = gdal.open(`${__dirname}/data/multiband.tif`)
+          const expected1 = ds1.bands.get(1).pixels.read(0, 0, 64, 64)
+          const expected2 = ds2.bands.get(1).pixels.read(0, 0, 64, 64)
+          const q = []
+          for (let i = 0; i < 16; i++) {
+            q.push(ds1.bands.get(1).pixels.readAsync(0, 0, 64, 64)
+              .then((data) => assert.deepEqual(data, expected1)))
+            q.push(ds2.bands.get(1).pixels.readAsync(0, 0, 64, 64)
+              .then((data) => assert.deepEqual(data, expected2)))
+          }
+          return assert.isFulfilled(Promise.all(q))
+        })
+        it('should support parallel reads on a dataset opened for parallel reading', () => {
+          const ds = gdal.open(`${__dirname}/data/multiband.tif`, 'rp')
+          const expected = ds.bands.map((band) => band.pixels.read(0, 0, 64, 64))
+          const q = []
+          for (let i = 0; i < 8; i++) {
+            ds.bands.forEach((band, idx) => {
+              q.push(band.pixels.readAsync(0, 0, 64, 64)
+                .then((data) => assert.deepEqual(data, expected[idx - 1])))
+              q.push(band.pixels.readBlockAsync(0, 0))
+              q.push(band.pixels.getAsync(i, i)
+                .then((v) => assert.equal(v, expected[idx - 1][i * 64 + i])))
+            })
+          }
+          return assert.isFulfilled(Promise.all(q).then(() => ds.close()))
+        })
+        it('should not wait for the running reads to retrieve the metadata of a dataset opened for parallel reading', () => {
+          const ds = gdal.openPool(`${__dirname}/data/sample.tif`, { size: 4 })
+          const band = ds.bands.get(1)
+          const size = band.size
+          let done = 0
+          const reads = [ 0, 1 ].map(() => band.pixels.readAsync(0, 0, size.x, size.y, undefined,
+            { buffer_width: size.x * 4, buffer_height: size.y * 4, resampling: gdal.GRA_Cubic })
+            .then(() => done++))
+          const getters = Promise.all([ ds.rasterSizeAsync, ds.geoTransformAsync, band.dataTypeAsync, band.noDataValueAsync ])
+            .then(() => assert.equal(done, 0))
+          return assert.isFulfilled(Promise.all([ getters, ...reads ]).then(() => ds.close()))
+        })
         describe('w/data argument', () => {
           it('should put the data in the existing array', () => {
             const ds = gdal.openAsync('temp',
@@ -411,6 +452,74 @@ describe('gdal.RasterBandAsync', () => {
             }))
           })
         })
+        describe('readMultiAsync()', () => {
+          it('should return an array of TypedArrays', () => {
+            const ds = gdal.open(`${__dirname}/data/sample.tif`)
+            const band = ds.bands.get(1)
+            const windows = [ { x: 0, y: 0, w: 16, h: 16 }, { x: 100, y: 50, w: 3, h: 7 } ]
+            return assert.isFulfilled(band.pixels.readMultiAsync(windows).then((data) => {
+              assert.lengthOf(data, windows.length)
+              windows.forEach((w, i) => assert.deepEqual(data[i], band.pixels.read(w.x, w.y, w.w, w.h)))
+            }))
+          })
+          it('should reject on invalid windows', () => {
+            const ds = gdal.open(`${__dirname}/data/sample.tif`)
+            const band = ds.bands.get(1)
+            return assert.isRejected(band.pixels.readMultiAsync([ { x: 2000, y: 2000, w: 4, h: 4 } ]))
+          })
+        })
+        describe('sampleAsync()', () => {
+          it('should return the same values as sample()', () => {
+            const ds = gdal.open(`${__dirname}/data/sample.tif`)
+            const band = ds.bands.get(1)
+            const gt = ds.geoTransform as number[]
+            const coords = new Float64Array(200)
+            for (let i = 0; i < 100; i++) {
+              coords[i * 2] = gt[0] + gt[1] * (i * 7 + 0.5)
+              coords[i * 2 + 1] = gt[3] + gt[5] * (i * 3 + 0.5)
+            }
+            const expected = band.pixels.sample(coords)
+            return assert.isFulfilled(band.pixels.sampleAsync(coords).then((result) => {
+              assert.deepEqual(result.values, expected.values)
+              assert.deepEqual(result.mask, expected.mask)
+              for (let i = 0; i < 100; i++) {
+                if (result.mask[i]) assert.equal(result.values[i], band.pixels.get(i * 7, i * 3))
+              }
+            }))
+          })
+        })
+        describe('readBlockRefAsync()', () => {
+          it('should return the same data as readBlock()', () => {
+            const ds = gdal.open(`${__dirname}/data/sample.tif`)
+            const band = ds.bands.get(1)
+            const expected = band.pixels.readBlock(0, 0)
+            return assert.eventually.deepEqual(band.pixels.readBlockRefAsync(0, 0), expected)
+          })
+          it('should release the blocks when the arrays are garbage collected', async () => {
+            const ds = gdal.open(`${__dirname}/data/sample.tif`)
+            const band = ds.bands.get(1)
+            for (let i = 0; i < 64; i++) await band.pixels.readBlockRefAsync(0, 0)
+            assert.throws(() => {
+              ds.flush()
+            }, /readBlockRef/)
+            // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+            global.gc!()
+            // Node.js calls the free callbacks of the buffers on the next tick of the event loop
+            await new Promise((resolve) => setImmediate(resolve))
+            await new Promise((resolve) => setImmediate(resolve))
+            // Flushing is possible only once all the blocks have been released
+            assert.doesNotThrow(() => {
+              ds.flush()
+            })
+            ds.close()
+          })
+          it('should reject if the dataset is closed', () => {
+            const ds = gdal.open(`${__dirname}/data/sample.tif`)
+            const p = ds.bands.get(1).pixels.readBlockRefAsync(0, 0)
+            ds.close()
+            return assert.isRejected(p, /already destroyed/)
+          })
+        })
         describe('readBlockAsync()', () => {
           it('should return TypedArray', () => {
             const ds = gdal.open(`${__dirname}/data/sample.tif`)
@@ -1351,6 +1351,135 @@ describe('gdal.RasterBand', () => {
           })
         })
       })
+      describe('readMulti()', () => {
+        it('should return an array of TypedArrays', () => {
+          const ds = gdal.open(`${__dirname}/data/sample.tif`)
+          const band = ds.bands.get(1)
+          const windows = [ { x: 0, y: 0, w: 16, h: 16 }, { x: 100, y: 50, w: 3, h: 7 }, { x: 10, y: 10, w: 1, h: 1 } ]
+          const data = band.pixels.readMulti(windows)
+          assert.lengthOf(data, windows.length)
+          windows.forEach((w, i) => {
+            assert.instanceOf(data[i], Uint8Array)
+            assert.deepEqual(data[i], band.pixels.read(w.x, w.y, w.w, w.h))
+          })
+        })
+        it('should support data_type', () => {
+          const ds = gdal.open(`${__dirname}/data/sample.tif`)
+          const band = ds.bands.get(1)
+          const data = band.pixels.readMulti([ { x: 0, y: 0, w: 4, h: 4 } ], { data_type: gdal.GDT_Float64 })
+          assert.instanceOf(data[0], Float64Array)
+          assert.equal(data[0][5], band.pixels.get(1, 1))
+        })
+        it('should throw on invalid windows', () => {
+          const ds = gdal.open(`${__dirname}/data/sample.tif`)
+          const band = ds.bands.get(1)
+          assert.throws(() => {
+            band.pixels.readMulti([ { x: 0, y: 0, w: 0, h: 4 } ])
+          }, /must be positive/)
+          assert.throws(() => {
+            // eslint-disable-next-line @typescript-eslint/no-explicit-any
+            band.pixels.readMulti([ { x: 0, y: 0 } as any ])
+          }, /must contain property "w"/)
+          assert.throws(() => {
+            band.pixels.readMulti([ { x: 2000, y: 2000, w: 4, h: 4 } ])
+          })
+        })
+      })
+      describe('sample()', () => {
+        const createDataset = () => {
+          const ds = gdal.open('temp', 'w', 'MEM', 4, 4, 1, gdal.GDT_Float64)
+          ds.geoTransform = [ 100, 10, 0, 200, 0, -10 ]
+          ds.srs = gdal.SpatialReference.fromEPSG(3857)
+          const band = ds.bands.get(1)
+          band.noDataValue = -1
+          band.pixels.write(0, 0, 4, 4, new Float64Array([
+            0, 1, 2, 3,
+            4, 5, 6, 7,
+            8, 9, 10, 11,
+            12, 13, 14, -1
+          ]))
+          return ds
+        }
+        it('should return the values at the given coordinates', () => {
+          const ds = createDataset()
+          const result = ds.bands.get(1).pixels.sample(new Float64Array([ 105, 195, 115, 171, 125, 165 ]))
+          assert.instanceOf(result.values, Float64Array)
+          assert.instanceOf(result.mask, Uint8Array)
+          assert.deepEqual(Array.from(result.values), [ 0, 9, 14 ])
+          assert.deepEqual(Array.from(result.mask), [ 1, 1, 1 ])
+        })
+        it('should mask the points outside of the raster and on nodata pixels', () => {
+          const ds = createDataset()
+          const result = ds.bands.get(1).pixels.sample(new Float64Array([ 50, 50, 135, 165 ]))
+          assert.isNaN(result.values[0])
+          assert.isNaN(result.values[1])
+          assert.deepEqual(Array.from(result.mask), [ 0, 0 ])
+        })
+        it('should support bilinear interpolation', () => {
+          const ds = createDataset()
+          const result = ds.bands.get(1).pixels.sample(new Float64Array([ 110, 190 ]), { interpolation: 'bilinear' })
+          assert.closeTo(result.values[0], (0 + 1 + 4 + 5) / 4, 1e-9)
+        })
+        it('should transform the coordinates from the given srs', () => {
+          const ds = createDataset()
+          const wgs84 = gdal.SpatialReference.fromEPSG(4326)
+          const ct = new gdal.CoordinateTransformation(ds.srs as gdal.SpatialReference, wgs84)
+          const pt = new gdal.Point(115, 171)
+          pt.transform(ct)
+          // EPSG:4326 is lat/lon but sample() always expects lon/lat
+          const result = ds.bands.get(1).pixels.sample(new Float64Array([ pt.y, pt.x ]), { srs: wgs84 })
+          assert.deepEqual(Array.from(result.values), [ 9 ])
+        })
+        it('should throw on invalid arguments', () => {
+          const ds = createDataset()
+          assert.throws(() => {
+            // eslint-disable-next-line @typescript-eslint/no-explicit-any
+            ds.bands.get(1).pixels.sample([ 1, 2 ] as any)
+          }, /Float64Array/)
+          assert.throws(() => {
+            ds.bands.get(1).pixels.sample(new Float64Array([ 1, 2, 3 ]))
+          }, /even number/)
+          assert.throws(() => {
+            ds.bands.get(1).pixels.sample(new Float64Array([ 1, 2 ]), { interpolation: 'cubic' })
+          }, /interpolation/)
+        })
+      })
+      describe('readBlockRef()', () => {
+        it('should return the same data as readBlock()', () => {
+          const ds = gdal.open(`${__dirname}/data/sample.tif`)
+          const band = ds.bands.get(1)
+          const data = band.pixels.readBlockRef(0, 0)
+          assert.instanceOf(data, Uint8Array)
+          assert.equal(data.length, band.blockSize.x * band.blockSize.y)
+          assert.deepEqual(data, band.pixels.readBlock(0, 0))
+        })
+        it('should detach the array when the dataset is closed', () => {
+          const ds = gdal.open(`${__dirname}/data/sample.tif`)
+          const data = ds.bands.get(1).pixels.readBlockRef(0, 0)
+          assert.isAbove(data.length, 0)
+          ds.close()
+          assert.equal(data.length, 0)
+        })
+        it('should not allow flushing while the array is referenced', () => {
+          const ds = gdal.open(`${__dirname}/data/sample.tif`)
+          const data = ds.bands.get(1).pixels.readBlockRef(0, 0)
+          assert.throws(() => {
+            ds.flush()
+          }, /readBlockRef/)
+          assert.throws(() => {
+            ds.bands.get(1).flush()
+          }, /readBlockRef/)
+          assert.isAbove(data.length, 0)
+          ds.close()
+        })
+        it('should throw error if offsets are out of range', () => {
+          const ds = gdal.open(`${__dirname}/data/sample.tif`)
+          const band = ds.bands.get(1)
+          assert.throws(() => {
+            band.pixels.readBlockRef(-1, 0)
+          })
+        })
+      })
       describe('readBlock()', () => {
         it('should return TypedArray', () => {
           const ds = gdal.open(`${__dirname}/data/sample.tif`)
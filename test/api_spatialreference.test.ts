@@ -156,6 +156,56 @@ describe('gdal.SpatialReference', () => {
       return assert.isRejected(gdal.SpatialReference.fromUserInputAsync(wms))
     })
   })
+  describe('fromWKTAsync', () => {
+    it('should return SpatialReference', () => {
+      const wkt = gdal.SpatialReference.fromEPSG(4326).toWKT()
+      return assert.eventually.instanceOf(gdal.SpatialReference.fromWKTAsync(wkt), gdal.SpatialReference)
+    })
+    it('should reject on invalid WKT', () =>
+      assert.isRejected(gdal.SpatialReference.fromWKTAsync('GEOGCS["invalid'))
+    )
+  })
+  describe('fromProj4Async', () => {
+    it('should return SpatialReference', () => {
+      const proj = '+proj=longlat +datum=WGS84 +no_defs'
+      return assert.eventually.instanceOf(gdal.SpatialReference.fromProj4Async(proj), gdal.SpatialReference)
+    })
+  })
+  describe('fromEPSGAsync', () => {
+    it('should return SpatialReference', () =>
+      gdal.SpatialReference.fromEPSGAsync(4326).then((ref) => {
+        assert.instanceOf(ref, gdal.SpatialReference)
+        assert.isTrue(ref.isSame(gdal.SpatialReference.fromEPSG(4326)))
+      })
+    )
+    it('should reject on invalid EPSG', () =>
+      assert.isRejected(gdal.SpatialReference.fromEPSGAsync(99191))
+    )
+  })
+  describe('fromEPSGAAsync', () => {
+    it('should return SpatialReference', () =>
+      assert.eventually.instanceOf(gdal.SpatialReference.fromEPSGAAsync(26910), gdal.SpatialReference)
+    )
+    it('should reject on invalid EPSGA', () =>
+      assert.isRejected(gdal.SpatialReference.fromEPSGAAsync(99191))
+    )
+  })
+  describe('fromESRIAsync', () => {
+    it('should return SpatialReference', () => {
+      const esri = [
+        'GEOGCS["GCS_North_American_1983",DATUM["D_North_American_1983",SPHEROID["GRS_1980",6378137,298.257222101]],PRIMEM["Greenwich",0],UNIT["Degree",0.017453292519943295]]'
+      ]
+      return assert.eventually.instanceOf(gdal.SpatialReference.fromESRIAsync(esri), gdal.SpatialReference)
+    })
+    it('should reject on invalid input', () =>
+      assert.isRejected(gdal.SpatialReference.fromESRIAsync([ 'Corneilles["ébouriffées"]' ]))
+    )
+  })
+  describe('validateAsync', () => {
+    it('should validate a valid SpatialReference', () =>
+      assert.eventually.isNull(gdal.SpatialReference.fromEPSG(4326).validateAsync())
+    )
+  })
   describe('fromURL w/Net', () => {
     it('should return SpatialReference', () => {
       const ref = gdal.SpatialReference.fromURL('http://spatialreference.org/ref/epsg/4326/')
@@ -32,14 +32,14 @@ describe('gdal.RasterReadStream', () => {
     })
   }
 
-  function readTest(done: doneCb, file: string, blockOptimize: boolean) {
+  function readTest(done: doneCb, file: string, blockOptimize: boolean, readAhead?: number) {
     const ds = gdal.open(path.resolve(__dirname, 'data', file))
     const band = ds.bands.get(1)
     const expected = band.pixels.read(0, 0, band.size.x, band.size.y)
     const type = gdal.fromDataType(band.dataType)
     const actual = new type(band.size.x * band.size.y)
 
-    const rs = band.pixels.createReadStream({ blockOptimize })
+    const rs = band.pixels.createReadStream({ blockOptimize, readAhead })
     assert.instanceOf(rs, gdal.RasterReadStream)
     let length = 0
     rs.on('data', (chunk) => {
@@ -79,11 +79,70 @@ describe('gdal.RasterReadStream', () => {
   it('should accept a raster band w/o blockOptimize', (done) => readTest(done, 'sample.tif', false))
   it('should accept a raster band w/Float', (done) => readTest(done, 'AROME_T2m_10.tiff', true))
   it('should accept a raster band w/Float w/o blockOptimize', (done) => readTest(done, 'AROME_T2m_10.tiff', false))
+  it('should support readAhead', (done) => readTest(done, 'AROME_T2m_10.tiff', true, 4))
+  it('should support readAhead w/o blockOptimize', (done) => readTest(done, 'AROME_T2m_10.tiff', false, 4))
+  it('should throw on invalid readAhead', () => {
+    const ds = gdal.open(path.resolve(__dirname, 'data', 'sample.tif'))
+    assert.throws(() => {
+      ds.bands.get(1).pixels.createReadStream({ readAhead: 0 })
+    }, /must be a positive integer/)
+  })
   it('should support on the fly conversion w/ noData', (done) => noDataTest(done, 'dem_azimuth50_pa.img', undefined))
   it('should support noData conversion', (done) => noDataTest(done, 'dem_azimuth50_pa.img', true))
   for (const file of inputFiles) {
     it(`should accept various formats (${file})`, (done) => readTest(done, file, true))
   }
+
+  describe('w/ pool', () => {
+    async function poolTest(blockOptimize: boolean) {
+      const ds = gdal.open(path.resolve(__dirname, 'data', 'AROME_T2m_10.tiff'))
+      const band = ds.bands.get(1)
+      const expected = band.pixels.read(0, 0, band.size.x, band.size.y)
+      const actual = new Float64Array(band.size.x * band.size.y)
+
+      const rs = band.pixels.createReadStream({ blockOptimize, pool: 4, type: Float64Array, highWaterMark: 1 })
+      const buffers = new Set<ArrayBufferLike>()
+      let length = 0
+      for await (const chunk of rs) {
+        assert.instanceOf(chunk, Float64Array)
+        actual.set(chunk, length)
+        length += chunk.length
+        buffers.add(chunk.buffer)
+        rs.release(chunk)
+      }
+      assert.equal(length, band.size.x * band.size.y)
+      assert.deepEqual(actual, expected)
+      assert.isBelow(buffers.size, blockOptimize ? band.size.y / band.blockSize.y : band.size.y)
+    }
+
+    it('should reuse the released buffers', () => poolTest(true))
+    it('should reuse the released buffers w/o blockOptimize', () => poolTest(false))
+    it('should ignore foreign buffers', () => {
+      const ds = gdal.open(path.resolve(__dirname, 'data', 'sample.tif'))
+      const rs = ds.bands.get(1).pixels.createReadStream({ pool: 4 })
+      return new Promise<void>((resolve, reject) => {
+        rs.once('data', (chunk) => {
+          try {
+            rs.release(new Float64Array(chunk.length))
+            rs.release(new chunk.constructor(chunk.length + 1))
+            rs.release(chunk)
+            rs.release(chunk)
+            assert.lengthOf((rs as unknown as { pool: unknown[] }).pool, 1)
+            rs.destroy()
+            resolve()
+          } catch (e) {
+            reject(e)
+          }
+        })
+      })
+    })
+    it('should throw on invalid pool size', () => {
+      const ds = gdal.open(path.resolve(__dirname, 'data', 'sample.tif'))
+      assert.throws(() => {
+        ds.bands.get(1).pixels.createReadStream({ pool: -1 })
+      }, /must be a non-negative number/)
+    })
+  })
 })
 
 describe('gdal.RasterWriteStream', () => {
@@ -328,4 +387,75 @@ describe('gdal.RasterMuxStream', () => {
 
   it('should accept multiple inputs', () => testMux(undefined))
   it('should support different block sizes', () => testMux(false))
+  it('should recycle the released chunks', async () => {
+    const dsT2m = gdal.open(path.resolve(__dirname, 'data', 'AROME_T2m_10.tiff'))
+    const dsD2m = gdal.open(path.resolve(__dirname, 'data', 'AROME_D2m_10.tiff'))
+    const size = dsT2m.rasterSize.x * dsT2m.rasterSize.y
+    const expected = dsT2m.bands.get(1).pixels.read(0, 0, dsT2m.rasterSize.x, dsT2m.rasterSize.y)
+
+    const mux = new gdal.RasterMuxStream({
+      T2m: dsT2m.bands.get(1).pixels.createReadStream({ pool: 4 }),
+      D2m: dsD2m.bands.get(1).pixels.createReadStream({ pool: 4, blockOptimize: false })
+    }, { pool: 4 })
+
+    const actual = new Float64Array(size)
+    let length = 0
+    for await (const chunk of mux) {
+      assert.equal(chunk.T2m.length, chunk.D2m.length)
+      actual.set(chunk.T2m, length)
+      length += chunk.T2m.length
+      mux.release(chunk)
+    }
+    assert.equal(length, size)
+    assert.deepEqual(actual, expected)
+  })
+})
+
+describe('gdal.LayerGeoJSONStream', () => {
+  const collect = (rs: NodeJS.ReadableStream): Promise<string> => new Promise((resolve, reject) => {
+    const chunks: Buffer[] = []
+    rs.on('data', (chunk: Buffer) => chunks.push(chunk))
+    rs.on('end', () => resolve(Buffer.concat(chunks).toString('utf8')))
+    rs.on('error', reject)
+  })
+  let ds: gdal.Dataset, layer: gdal.Layer
+  before(() => {
+    ds = gdal.open(path.resolve(__dirname, 'data', 'shp', 'sample.shp'))
+    layer = ds.layers.get(0)
+  })
+  after(() => ds.close())
+
+  it('should produce a GeoJSON FeatureCollection', () =>
+    collect(layer.createGeoJSONStream({ batchSize: 5 })).then((text) => {
+      const fc = JSON.parse(text)
+      assert.equal(fc.type, 'FeatureCollection')
+      assert.lengthOf(fc.features, layer.features.count())
+      const expected = layer.features.get(3)
+      const feature = fc.features[3]
+      assert.equal(feature.type, 'Feature')
+      assert.equal(feature.id, expected.fid)
+      assert.deepEqual(feature.properties, expected.fields.toObject())
+      assert.deepEqual(feature.geometry, (expected.getGeometry() as gdal.Geometry).toObject())
+    })
+  )
+  it('should produce newline-delimited GeoJSON', () =>
+    collect(layer.createGeoJSONStream({ ndjson: true, fields: [ 'name' ], precision: 2 })).then((text) => {
+      const lines = text.split('\n').filter((l) => l.length)
+      assert.lengthOf(lines, layer.features.count())
+      lines.forEach((line) => {
+        const feature = JSON.parse(line)
+        assert.deepEqual(Object.keys(feature.properties), [ 'name' ])
+      })
+      assert.notMatch(text, /\.\d{3}/)
+    })
+  )
+  it('should emit an error on unknown fields', () =>
+    collect(layer.createGeoJSONStream({ fields: [ 'unknown' ] }))
+      .then(() => assert.fail('should have failed'), (e) => assert.match(e.message, /does not exist/))
+  )
+  it('should throw on invalid batch size', () => {
+    assert.throws(() => {
+      layer.createGeoJSONStream({ batchSize: 0 })
+    }, /positive integer/)
+  })
 })
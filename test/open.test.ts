@@ -19,4 +19,61 @@ describe('Open', () => {
       gdal.open(filename)
     }, semver.gte(gdal.version, '3.0.0') ? /No such file or directory/ : /Error/)
   })
+  it('should open a dataset for parallel reading', () => {
+    const ds = gdal.open(path.join(__dirname, 'data/sample.tif'), 'rp')
+    assert.ok(ds instanceof gdal.Dataset)
+    ds.close()
+  })
+  it('should throw when opening for parallel reading in update mode', () => {
+    assert.throws(() => {
+      gdal.open(path.join(__dirname, 'data/sample.tif'), 'r+p')
+    }, /only in read-only mode/)
+  })
+  describe('openPool()', () => {
+    it('should open a dataset with a pool of handles', () => {
+      const ds = gdal.openPool(path.join(__dirname, 'data/multiband.tif'), { size: 3 })
+      assert.ok(ds instanceof gdal.Dataset)
+      const expected = ds.bands.get(2).pixels.read(0, 0, 32, 32)
+      const q = []
+      for (let i = 0; i < 12; i++) {
+        q.push(ds.bands.get(2).pixels.readAsync(0, 0, 32, 32).then((data) => assert.deepEqual(data, expected)))
+      }
+      return Promise.all(q).then(() => ds.close())
+    })
+    it('should refuse to change the metadata of a dataset with a pool of handles', () => {
+      const ds = gdal.openPool(path.join(__dirname, 'data/sample.tif'), { size: 2 })
+      assert.throws(() => {
+        ds.geoTransform = [ 0, 1, 0, 0, 0, 1 ]
+      }, /pool of handles/)
+      assert.throws(() => {
+        ds.bands.get(1).noDataValue = 0
+      }, /pool of handles/)
+      ds.close()
+    })
+    it('should throw on an invalid size', () => {
+      assert.throws(() => {
+        gdal.openPool(path.join(__dirname, 'data/sample.tif'), { size: 0 })
+      }, /at least 1/)
+    })
+    it('should throw when non-existing file', () => {
+      assert.throws(() => {
+        gdal.openPool(path.join(__dirname, 'data/inexisting'))
+      })
+    })
+  })
+  describe('openPoolAsync()', () => {
+    it('should open a dataset with a pool of handles', () =>
+      gdal.openPoolAsync(path.join(__dirname, 'data/sample.tif'), { size: 2 })
+        .then((ds) => {
+          assert.ok(ds instanceof gdal.Dataset)
+          ds.close()
+        }))
+    it('should reject when non-existing file', () =>
+      assert.rejects(gdal.openPoolAsync(path.join(__dirname, 'data/inexisting'))))
+  })
+  it('should throw on an invalid mode', () => {
+    assert.throws(() => {
+      gdal.open(path.join(__dirname, 'data/sample.tif'), 'rx')
+    }, /Invalid open mode/)
+  })
 })